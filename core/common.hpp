@@ -85,6 +85,7 @@ using std::shared_ptr;
 using std::unique_ptr;
 using std::weak_ptr;
 using std::make_shared;
+using std::allocate_shared;
 using ndn::make_unique;
 using std::enable_shared_from_this;
 
@@ -105,6 +105,24 @@ public:
   }
 };
 
+/** \brief represents a counter of accumulated time
+ *
+ *  The counter value is expressed in nanoseconds.
+ *  \warning The counter value may wrap after exceeding the range of underlying integer type.
+ */
+class DurationCounter : public SimpleCounter
+{
+public:
+  /** \brief increase the counter
+   */
+  DurationCounter&
+  operator+=(time::nanoseconds d)
+  {
+    m_value += static_cast<rep>(d.count());
+    return *this;
+  }
+};
+
 /** \brief provides a counter that observes the size of a table
  *  \tparam T a type that provides a size() const member function
  *
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_SPSC_RING_HPP
+#define NFD_CORE_SPSC_RING_HPP
+
+#include "common.hpp"
+
+#include <atomic>
+
+namespace nfd {
+
+/** \brief a bounded lock-free queue between one producer thread and one consumer thread
+ *  \tparam T item type, which must be move constructible
+ *
+ *  tryPush may only be called on the producer thread, and tryPop may only be called on
+ *  the consumer thread. Neither blocks: tryPush fails when the ring is full, and tryPop
+ *  fails when the ring is empty.
+ *
+ *  The producer and the consumer each keep a private copy of the other side's index,
+ *  and refresh it only when the ring appears full or empty, so that in steady state
+ *  an operation touches shared cache lines only to publish its own index.
+ */
+template<typename T>
+class SpscRing : noncopyable
+{
+public:
+  /** \param capacity minimum number of items the ring can hold; rounded up to a power of 2
+   */
+  explicit
+  SpscRing(size_t capacity)
+    : m_mask(roundUpCapacity(capacity) - 1)
+    , m_slots(new Slot[m_mask + 1])
+    , m_head(0)
+    , m_cachedTail(0)
+    , m_tail(0)
+    , m_cachedHead(0)
+  {
+  }
+
+  ~SpscRing()
+  {
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    for (size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i) {
+      reinterpret_cast<T*>(&m_slots[i & m_mask])->~T();
+    }
+  }
+
+  /** \return number of items the ring can hold
+   */
+  size_t
+  capacity() const
+  {
+    return m_mask + 1;
+  }
+
+  /** \return number of items in the ring
+   *  \note The result is approximate if the other thread is operating concurrently.
+   */
+  size_t
+  size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+  /** \brief appends an item, if the ring is not full
+   *  \retval false the ring is full; \p item is unchanged
+   */
+  bool
+  tryPush(T&& item)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cachedHead > m_mask) {
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead > m_mask) {
+        return false;
+      }
+    }
+
+    new (&m_slots[tail & m_mask]) T(std::move(item));
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool
+  tryPush(const T& item)
+  {
+    T copy(item);
+    return this->tryPush(std::move(copy));
+  }
+
+  /** \brief removes the oldest item, if the ring is not empty
+   *  \retval false the ring is empty; \p item is unchanged
+   */
+  bool
+  tryPop(T& item)
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_cachedTail) {
+      m_cachedTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cachedTail) {
+        return false;
+      }
+    }
+
+    T* slot = reinterpret_cast<T*>(&m_slots[head & m_mask]);
+    item = std::move(*slot);
+    slot->~T();
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static size_t
+  roundUpCapacity(size_t capacity)
+  {
+    size_t n = 1;
+    while (n < capacity) {
+      n <<= 1;
+    }
+    return n;
+  }
+
+private:
+  typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  const size_t m_mask;
+  unique_ptr<Slot[]> m_slots;
+
+  // consumer side
+  char m_pad0[CACHE_LINE_SIZE];
+  std::atomic<size_t> m_head;
+  size_t m_cachedTail;
+
+  // producer side
+  char m_pad1[CACHE_LINE_SIZE];
+  std::atomic<size_t> m_tail;
+  size_t m_cachedHead;
+  char m_pad2[CACHE_LINE_SIZE];
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_SPSC_RING_HPP
@@ -27,9 +27,16 @@
 #define NFD_DAEMON_FACE_DATAGRAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "io-thread.hpp"
+#include "socket-utils.hpp"
 #include "core/global-io.hpp"
+#include "core/spsc-ring.hpp"
 
 #include <array>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <unistd.h> // for dup()
 
 namespace nfd {
 namespace face {
@@ -54,12 +61,37 @@ public:
   explicit
   DatagramTransport(typename protocol::socket&& socket);
 
+  ~DatagramTransport() override;
+
+  size_t
+  getSendQueueLength() override;
+
   /** \brief Receive datagram, translate buffer into packet, deliver to parent class.
    */
   void
   receiveDatagram(const uint8_t* buffer, size_t nBytesReceived,
                   const boost::system::error_code& error);
 
+  /** \return whether datagrams are received on an IoThread
+   */
+  bool
+  isReceivingOnIoThread() const
+  {
+    return m_rxSocket != nullptr;
+  }
+
+  /** \return number of datagrams dropped by the IoThread because the receive ring was full
+   */
+  uint64_t
+  getNRxRingDrops() const
+  {
+    return m_rxQueue == nullptr ? 0 : m_rxQueue->nDrops.load(std::memory_order_relaxed);
+  }
+
+  /** \brief capacity of the ring between the IoThread and the forwarding thread
+   */
+  static constexpr size_t RX_RING_CAPACITY = 1024;
+
 protected:
   void
   doClose() override;
@@ -87,6 +119,22 @@ protected:
   static EndpointId
   makeEndpointId(const typename protocol::endpoint& ep);
 
+private:
+  /** \brief start receiving on \p ioThread with a duplicate of m_socket
+   */
+  void
+  startReceiveOnIoThread(shared_ptr<IoThread> ioThread);
+
+  /** \brief handle a receive completion on the IoThread
+   */
+  void
+  handleReceiveOnIoThread(const boost::system::error_code& error, size_t nBytesReceived);
+
+  /** \brief close m_rxSocket, then invoke \p done on the IoThread after aborted handlers
+   */
+  void
+  closeRxSocket(const std::function<void()>& done);
+
 protected:
   typename protocol::socket m_socket;
   typename protocol::endpoint m_sender;
@@ -94,22 +142,139 @@ protected:
   NFD_LOG_INCLASS_DECLARE();
 
 private:
+  struct ReceivedDatagram
+  {
+    shared_ptr<ndn::Buffer> buffer;
+    typename protocol::endpoint sender;
+  };
+
+  /** \brief datagrams received on the IoThread, waiting to be processed on the forwarding thread
+   *
+   *  Handlers posted to the forwarding thread hold a weak_ptr to this object, so that they
+   *  become no-ops if the transport is destroyed before they run.
+   */
+  struct RxQueue
+  {
+    explicit
+    RxQueue(size_t capacity)
+      : ring(capacity)
+      , isDrainScheduled(false)
+      , nDrops(0)
+    {
+    }
+
+    /** \brief deliver queued datagrams on the forwarding thread
+     */
+    void
+    drain(DatagramTransport& transport);
+
+    SpscRing<ReceivedDatagram> ring;
+    std::atomic<bool> isDrainScheduled;
+    std::atomic<uint64_t> nDrops;
+  };
+
   std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
   bool m_hasRecentlyReceived;
+
+  boost::asio::io_service& m_forwardingIo;
+  shared_ptr<IoThread> m_ioThread;
+  unique_ptr<typename protocol::socket> m_rxSocket; ///< accessed only on m_ioThread
+  typename protocol::endpoint m_rxSender; ///< accessed only on m_ioThread
+  shared_ptr<RxQueue> m_rxQueue;
 };
 
+template<class T, class U>
+constexpr size_t DatagramTransport<T, U>::RX_RING_CAPACITY;
+
 
 template<class T, class U>
 DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
   , m_hasRecentlyReceived(false)
+  , m_forwardingIo(getGlobalIoService())
 {
+  shared_ptr<IoThread> ioThread = getIoThread();
+  if (ioThread != nullptr) {
+    startReceiveOnIoThread(std::move(ioThread));
+    return;
+  }
+
   m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
                               bind(&DatagramTransport<T, U>::handleReceive, this,
                                    boost::asio::placeholders::error,
                                    boost::asio::placeholders::bytes_transferred));
 }
 
+template<class T, class U>
+DatagramTransport<T, U>::~DatagramTransport()
+{
+  if (m_rxSocket == nullptr) {
+    return;
+  }
+
+  // The transport may be destroyed without being closed (e.g., during shutdown).
+  // Wait until the IoThread no longer references this transport.
+  std::promise<void> isRxClosed;
+  m_ioThread->getIoService().post([this, &isRxClosed] {
+    closeRxSocket([&isRxClosed] { isRxClosed.set_value(); });
+  });
+  isRxClosed.get_future().wait();
+}
+
+template<class T, class U>
+size_t
+DatagramTransport<T, U>::getSendQueueLength()
+{
+  if (!m_socket.is_open()) {
+    return 0;
+  }
+  return getTxQueueLength(m_socket.native_handle());
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::startReceiveOnIoThread(shared_ptr<IoThread> ioThread)
+{
+  // The IoThread receives on a duplicate descriptor, so that m_socket is never accessed
+  // concurrently from two threads. m_socket is still used for sending.
+  int fd = ::dup(m_socket.native_handle());
+  if (fd < 0) {
+    NFD_LOG_FACE_WARN("Cannot duplicate socket, receiving on the forwarding thread: " <<
+                      std::strerror(errno));
+    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+                                bind(&DatagramTransport<T, U>::handleReceive, this,
+                                     boost::asio::placeholders::error,
+                                     boost::asio::placeholders::bytes_transferred));
+    return;
+  }
+
+  m_ioThread = std::move(ioThread);
+  m_rxQueue = make_shared<RxQueue>(RX_RING_CAPACITY);
+  m_rxSocket = make_unique<typename protocol::socket>(m_ioThread->getIoService());
+  m_rxSocket->assign(m_socket.local_endpoint().protocol(), fd);
+
+  m_ioThread->getIoService().post([this] {
+    m_rxSocket->async_receive_from(boost::asio::buffer(m_receiveBuffer), m_rxSender,
+                                   bind(&DatagramTransport<T, U>::handleReceiveOnIoThread, this,
+                                        boost::asio::placeholders::error,
+                                        boost::asio::placeholders::bytes_transferred));
+  });
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::closeRxSocket(const std::function<void()>& done)
+{
+  if (m_rxSocket->is_open()) {
+    boost::system::error_code error;
+    m_rxSocket->cancel(error);
+    m_rxSocket->close(error);
+  }
+
+  // handlers aborted by close() are already queued, so this runs after all of them
+  m_ioThread->getIoService().post(done);
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::doClose()
@@ -124,6 +289,19 @@ DatagramTransport<T, U>::doClose()
     m_socket.close(error);
   }
 
+  if (m_rxSocket != nullptr) {
+    // Close the receive socket on the IoThread. Handlers it has posted to the forwarding thread
+    // are queued before the following one, so the transport stays alive until they have run.
+    m_ioThread->getIoService().post([this] {
+      closeRxSocket([this] {
+        m_forwardingIo.post([this] {
+          this->setState(TransportState::CLOSED);
+        });
+      });
+    });
+    return;
+  }
+
   // Ensure that the Transport stays alive at least until
   // all pending handlers are dispatched
   getGlobalIoService().post([this] {
@@ -188,6 +366,67 @@ DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error,
                                      boost::asio::placeholders::bytes_transferred));
 }
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleReceiveOnIoThread(const boost::system::error_code& error,
+                                                 size_t nBytesReceived)
+{
+  // this function runs on the IoThread, and must not touch anything but m_rxSocket,
+  // m_rxSender, m_receiveBuffer, and m_rxQueue
+  if (error == boost::asio::error::operation_aborted || !m_rxSocket->is_open()) {
+    return;
+  }
+
+  weak_ptr<RxQueue> weakQueue = m_rxQueue;
+  if (error) {
+    m_forwardingIo.post([this, weakQueue, error] {
+      if (!weakQueue.expired()) {
+        this->processErrorCode(error);
+      }
+    });
+  }
+  else if (m_rxQueue->ring.tryPush(ReceivedDatagram{
+             make_shared<ndn::Buffer>(m_receiveBuffer.data(), nBytesReceived), m_rxSender})) {
+    // schedule at most one drain per burst of datagrams
+    if (!m_rxQueue->isDrainScheduled.exchange(true)) {
+      m_forwardingIo.post([this, weakQueue] {
+        shared_ptr<RxQueue> queue = weakQueue.lock();
+        if (queue != nullptr) {
+          queue->drain(*this);
+        }
+      });
+    }
+  }
+  else {
+    m_rxQueue->nDrops.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  m_rxSocket->async_receive_from(boost::asio::buffer(m_receiveBuffer), m_rxSender,
+                                 bind(&DatagramTransport<T, U>::handleReceiveOnIoThread, this,
+                                      boost::asio::placeholders::error,
+                                      boost::asio::placeholders::bytes_transferred));
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::RxQueue::drain(DatagramTransport& transport)
+{
+  // clear the flag before popping, so that a datagram pushed after the last pop
+  // always schedules another drain
+  isDrainScheduled.store(false);
+
+  ReceivedDatagram datagram;
+  while (ring.tryPop(datagram)) {
+    TransportState state = transport.getState();
+    if (state != TransportState::UP && state != TransportState::DOWN) {
+      continue; // transport is shutting down, discard remaining datagrams
+    }
+    transport.m_sender = datagram.sender;
+    transport.receiveDatagram(datagram.buffer->data(), datagram.buffer->size(),
+                              boost::system::error_code());
+  }
+}
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::handleSend(const boost::system::error_code& error,
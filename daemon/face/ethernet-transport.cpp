@@ -25,6 +25,7 @@
 
 #include "ethernet-transport.hpp"
 #include "ethernet-protocol.hpp"
+#include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
 #include <pcap/pcap.h>
@@ -60,6 +61,16 @@ EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndp
   asyncRead();
 }
 
+size_t
+EthernetTransport::getSendQueueLength()
+{
+  // m_socket is a duplicate of the pcap descriptor, so it refers to the same packet socket
+  if (!m_socket.is_open()) {
+    return 0;
+  }
+  return getTxQueueLength(m_socket.native_handle());
+}
+
 void
 EthernetTransport::doClose()
 {
@@ -60,6 +60,9 @@ public:
   receivePayload(const uint8_t* payload, size_t length,
                  const ethernet::Address& sender);
 
+  size_t
+  getSendQueueLength() final;
+
 protected:
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
                     const ethernet::Address& remoteEndpoint);
@@ -24,6 +24,8 @@
  */
 
 #include "face-system.hpp"
+#include "generic-link-service.hpp"
+#include "io-thread.hpp"
 #include "protocol-factory.hpp"
 #include "core/global-io.hpp"
 #include "fw/face-table.hpp"
@@ -37,6 +39,10 @@ FaceSystem::FaceSystem(FaceTable& faceTable, shared_ptr<ndn::net::NetworkMonitor
   : m_faceTable(faceTable)
   , m_netmon(std::move(netmon))
 {
+  m_afterAddFaceConn = m_faceTable.afterAdd.connect([this] (Face& face) {
+    this->applyCongestionConfig(face);
+  });
+
   auto pfCtorParams = this->makePFCtorParams();
   for (const std::string& id : ProtocolFactory::listRegistered()) {
     NFD_LOG_TRACE("creating factory " << id);
@@ -51,7 +57,11 @@ FaceSystem::makePFCtorParams()
   return {addFace, m_netmon};
 }
 
-FaceSystem::~FaceSystem() = default;
+FaceSystem::~FaceSystem()
+{
+  // transports that are still alive keep their own reference to the IoThread
+  setIoThread(nullptr);
+}
 
 std::set<const ProtocolFactory*>
 FaceSystem::listProtocolFactories() const
@@ -89,6 +99,72 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
   ConfigContext context;
   context.isDryRun = isDryRun;
 
+  // process io_thread option before protocol factories, so that it applies to
+  // transports of channels and multicast faces created below
+  bool wantIoThread = false;
+  auto ioThreadOption = configSection.get_child_optional("io_thread");
+  if (ioThreadOption) {
+    wantIoThread = ConfigFile::parseYesNo(*ioThreadOption, "io_thread", "face_system");
+  }
+  if (!isDryRun) {
+    if (!wantIoThread) {
+      setIoThread(nullptr);
+    }
+    else if (getIoThread() == nullptr) {
+      setIoThread(make_shared<IoThread>());
+    }
+  }
+
+  // process congestion section; its presence enables active queue management
+  GenericLinkService::Options defaultOptions;
+  CongestionConfig congestionConfig;
+  congestionConfig.target = defaultOptions.congestionTarget;
+  congestionConfig.threshold = defaultOptions.congestionThreshold;
+  congestionConfig.interval = defaultOptions.congestionInterval;
+  auto congestionSection = configSection.get_child_optional("congestion");
+  if (congestionSection) {
+    congestionConfig.isEnabled = true;
+    for (const auto& pair : *congestionSection) {
+      const std::string& key = pair.first;
+      if (key == "target") {
+        congestionConfig.target = time::milliseconds(
+          ConfigFile::parseNumber<uint32_t>(pair, "face_system.congestion"));
+      }
+      else if (key == "threshold") {
+        congestionConfig.threshold = ConfigFile::parseNumber<size_t>(pair, "face_system.congestion");
+      }
+      else if (key == "interval") {
+        congestionConfig.interval = time::milliseconds(
+          ConfigFile::parseNumber<uint32_t>(pair, "face_system.congestion"));
+      }
+      else if (key == "action") {
+        const std::string& action = pair.second.get_value<std::string>();
+        if (action == "mark") {
+          congestionConfig.wantDrop = false;
+        }
+        else if (action == "drop") {
+          congestionConfig.wantDrop = true;
+        }
+        else {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.congestion.action: '" +
+                                                  action + "' is neither 'mark' nor 'drop'"));
+        }
+      }
+      else {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option face_system.congestion." + key));
+      }
+    }
+    if (congestionConfig.interval <= time::nanoseconds::zero()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.congestion.interval must be positive"));
+    }
+  }
+  if (!isDryRun) {
+    m_congestionConfig = congestionConfig;
+    for (Face& face : m_faceTable) {
+      this->applyCongestionConfig(face);
+    }
+  }
+
   // process sections in protocol factories
   for (const auto& pair : m_factories) {
     const std::string& sectionName = pair.first;
@@ -123,7 +199,8 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Duplicate section face_system." + sectionName));
     }
 
-    if (m_factories.count(sectionName) > 0) {
+    if (m_factories.count(sectionName) > 0 || sectionName == "io_thread" ||
+        sectionName == "congestion") {
       continue;
     }
 
@@ -133,5 +210,26 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
   }
 }
 
+void
+FaceSystem::applyCongestionConfig(Face& face) const
+{
+  if (face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+    return;
+  }
+
+  auto service = dynamic_cast<GenericLinkService*>(face.getLinkService());
+  if (service == nullptr) {
+    return;
+  }
+
+  GenericLinkService::Options options = service->getOptions();
+  options.allowCongestionMarking = m_congestionConfig.isEnabled;
+  options.congestionTarget = m_congestionConfig.target;
+  options.congestionThreshold = m_congestionConfig.threshold;
+  options.congestionInterval = m_congestionConfig.interval;
+  options.dropOnCongestion = m_congestionConfig.wantDrop;
+  service->setOptions(options);
+}
+
 } // namespace face
 } // namespace nfd
@@ -97,6 +97,11 @@ private:
   processConfig(const ConfigSection& configSection, bool isDryRun,
                 const std::string& filename);
 
+  /** \brief apply active queue management settings to a non-local face with GenericLinkService
+   */
+  void
+  applyCongestionConfig(Face& face) const;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief config section name => protocol factory
    */
@@ -112,6 +117,19 @@ private:
   FaceTable& m_faceTable;
 
   shared_ptr<ndn::net::NetworkMonitor> m_netmon;
+
+  /** \brief active queue management settings from face_system.congestion section
+   */
+  struct CongestionConfig
+  {
+    bool isEnabled = false;
+    time::nanoseconds target;
+    size_t threshold;
+    time::nanoseconds interval;
+    bool wantDrop = false;
+  };
+  CongestionConfig m_congestionConfig;
+  signal::ScopedConnection m_afterAddFaceConn;
 };
 
 } // namespace face
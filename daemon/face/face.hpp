@@ -31,6 +31,8 @@
 #include "link-service.hpp"
 #include "transport.hpp"
 
+#include <ndn-cxx/lp/tags.hpp>
+
 namespace nfd {
 namespace face {
 
@@ -123,6 +125,14 @@ public: // static properties
   void
   setId(FaceId id);
 
+  /** \return an IncomingFaceIdTag that carries the face ID
+   *
+   *  Tags are immutable, so this tag is shared by all packets received on the face,
+   *  and the forwarding pipelines do not need to allocate a tag for every packet.
+   */
+  const shared_ptr<lp::IncomingFaceIdTag>&
+  getIncomingFaceIdTag() const;
+
   /** \return a FaceUri representing local endpoint
    */
   FaceUri
@@ -187,6 +197,7 @@ public: // dynamic properties
 
 private:
   FaceId m_id;
+  shared_ptr<lp::IncomingFaceIdTag> m_incomingFaceIdTag;
   unique_ptr<LinkService> m_service;
   unique_ptr<Transport> m_transport;
   FaceCounters m_counters;
@@ -232,6 +243,13 @@ inline void
 Face::setId(FaceId id)
 {
   m_id = id;
+  m_incomingFaceIdTag = make_shared<lp::IncomingFaceIdTag>(id);
+}
+
+inline const shared_ptr<lp::IncomingFaceIdTag>&
+Face::getIncomingFaceIdTag() const
+{
+  return m_incomingFaceIdTag;
 }
 
 inline FaceUri
@@ -24,8 +24,11 @@
  */
 
 #include "generic-link-service.hpp"
+#include "shared-encoding.hpp"
 #include <ndn-cxx/lp/tags.hpp>
 
+#include <cmath>
+
 namespace nfd {
 namespace face {
 
@@ -35,6 +38,11 @@ GenericLinkService::Options::Options()
   : allowLocalFields(false)
   , allowFragmentation(false)
   , allowReassembly(false)
+  , allowCongestionMarking(false)
+  , congestionTarget(time::milliseconds(5))
+  , congestionThreshold(65536)
+  , congestionInterval(time::milliseconds(100))
+  , dropOnCongestion(false)
 {
 }
 
@@ -44,6 +52,10 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   , m_reassembler(m_options.reassemblerOptions, this)
   , m_reliability(m_options.reliabilityOptions, this)
   , m_lastSeqNo(-2)
+  , m_firstAboveTargetTime(time::steady_clock::TimePoint::min())
+  , m_nextCongestionSignalTime(time::steady_clock::TimePoint::min())
+  , m_nCongestionSignals(0)
+  , m_isCongested(false)
 {
   m_reassembler.beforeTimeout.connect(bind([this] { ++this->nReassemblyTimeouts; }));
   m_reliability.onDroppedInterest.connect([this] (const Interest& i) { this->notifyDroppedInterest(i); });
@@ -87,31 +99,72 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt)
 void
 GenericLinkService::doSendInterest(const Interest& interest)
 {
+  CongestionAction congestionAction = this->decideCongestionAction();
+  if (congestionAction == CongestionAction::DROP) {
+    NFD_LOG_FACE_DEBUG("send queue congested, dropping Interest " << interest.getName());
+    this->notifyDroppedInterest(interest);
+    return;
+  }
+
+  if (congestionAction == CongestionAction::NONE && !m_options.reliabilityOptions.isEnabled &&
+      this->sendSharedNetPacket(interest, interest.wireEncode())) {
+    return;
+  }
+
   lp::Packet lpPacket(interest.wireEncode());
 
   encodeLpFields(interest, lpPacket);
 
+  if (congestionAction == CongestionAction::MARK) {
+    lpPacket.set<lp::CongestionMarkField>(1);
+  }
+
   this->sendNetPacket(std::move(lpPacket), true);
 }
 
 void
 GenericLinkService::doSendData(const Data& data)
 {
+  CongestionAction congestionAction = this->decideCongestionAction();
+  if (congestionAction == CongestionAction::DROP) {
+    NFD_LOG_FACE_DEBUG("send queue congested, dropping Data " << data.getName());
+    return;
+  }
+
+  if (congestionAction == CongestionAction::NONE && !m_options.reliabilityOptions.isEnabled &&
+      this->sendSharedNetPacket(data, data.wireEncode())) {
+    return;
+  }
+
   lp::Packet lpPacket(data.wireEncode());
 
   encodeLpFields(data, lpPacket);
 
+  if (congestionAction == CongestionAction::MARK) {
+    lpPacket.set<lp::CongestionMarkField>(1);
+  }
+
   this->sendNetPacket(std::move(lpPacket), false);
 }
 
 void
 GenericLinkService::doSendNack(const lp::Nack& nack)
 {
+  CongestionAction congestionAction = this->decideCongestionAction();
+  if (congestionAction == CongestionAction::DROP) {
+    NFD_LOG_FACE_DEBUG("send queue congested, dropping Nack " << nack.getInterest().getName());
+    return;
+  }
+
   lp::Packet lpPacket(nack.getInterest().wireEncode());
   lpPacket.add<lp::NackField>(nack.getHeader());
 
   encodeLpFields(nack, lpPacket);
 
+  if (congestionAction == CongestionAction::MARK) {
+    lpPacket.set<lp::CongestionMarkField>(1);
+  }
+
   this->sendNetPacket(std::move(lpPacket), false);
 }
 
@@ -131,6 +184,97 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
   }
 }
 
+bool
+GenericLinkService::sendSharedNetPacket(const ndn::PacketBase& netPkt, const Block& wire)
+{
+  BOOST_ASSERT(!m_options.reliabilityOptions.isEnabled);
+
+  shared_ptr<SharedEncodingTag> tag = netPkt.getTag<SharedEncodingTag>();
+  if (tag == nullptr || !tag->isFor(netPkt)) {
+    return false;
+  }
+
+  Block& lpPkt = tag->getLpPacket(m_options.allowLocalFields);
+  if (!lpPkt.hasWire()) {
+    lp::Packet lpPacket(wire);
+    encodeLpFields(netPkt, lpPacket);
+    lpPkt = lpPacket.wireEncode();
+  }
+
+  // a packet that fits in MTU is sent without per-link fields;
+  // otherwise, it is fragmented or dropped as over MTU by sendNetPacket
+  ssize_t mtu = this->getTransport()->getMtu();
+  size_t size = lpPkt.size();
+  bool canSend = mtu == MTU_UNLIMITED ||
+                 (m_options.allowFragmentation ? !LpFragmenter::needsFragmentation(size, mtu) :
+                                                 size <= static_cast<size_t>(mtu));
+  if (!canSend) {
+    return false;
+  }
+
+  this->sendPacket(Transport::Packet(Block(lpPkt)));
+  return true;
+}
+
+GenericLinkService::CongestionAction
+GenericLinkService::decideCongestionAction()
+{
+  if (!m_options.allowCongestionMarking || !this->checkCongestion(time::steady_clock::now())) {
+    return CongestionAction::NONE;
+  }
+
+  if (m_options.dropOnCongestion) {
+    ++this->nCongestionDropped;
+    return CongestionAction::DROP;
+  }
+  ++this->nCongestionMarked;
+  return CongestionAction::MARK;
+}
+
+bool
+GenericLinkService::checkCongestion(time::steady_clock::TimePoint now)
+{
+  time::nanoseconds delay = this->getTransport()->getSendQueueDelay();
+  size_t length = this->getTransport()->getSendQueueLength();
+  if (delay < m_options.congestionTarget && length < m_options.congestionThreshold) {
+    m_firstAboveTargetTime = time::steady_clock::TimePoint::min();
+    m_isCongested = false;
+    return false;
+  }
+
+  if (m_firstAboveTargetTime == time::steady_clock::TimePoint::min()) {
+    m_firstAboveTargetTime = now;
+    return false;
+  }
+
+  if (!m_isCongested) {
+    if (now - m_firstAboveTargetTime < m_options.congestionInterval) {
+      return false;
+    }
+    m_isCongested = true;
+    // if the previous congested episode ended recently, resume near its signaling rate
+    if (m_nCongestionSignals > 2 &&
+        now < m_nextCongestionSignalTime + m_options.congestionInterval) {
+      m_nCongestionSignals -= 2;
+    }
+    else {
+      m_nCongestionSignals = 1;
+    }
+  }
+  else if (now < m_nextCongestionSignalTime) {
+    return false;
+  }
+  else {
+    ++m_nCongestionSignals;
+  }
+
+  NFD_LOG_FACE_TRACE("send-queue delay " << delay << " length " << length <<
+                     " above target, signal #" << m_nCongestionSignals);
+  m_nextCongestionSignalTime = now + time::duration_cast<time::nanoseconds>(
+                                       m_options.congestionInterval / std::sqrt(m_nCongestionSignals));
+  return true;
+}
+
 void
 GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
 {
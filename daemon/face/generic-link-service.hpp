@@ -81,6 +81,15 @@ public:
    *         of retransmissions
    */
   PacketCounter nRetxExhausted;
+
+  /** \brief count of outgoing network-layer packets marked with CongestionMark
+   *         by active queue management
+   */
+  PacketCounter nCongestionMarked;
+
+  /** \brief count of outgoing network-layer packets dropped by active queue management
+   */
+  PacketCounter nCongestionDropped;
 };
 
 /** \brief GenericLinkService is a LinkService that implements the NDNLPv2 protocol
@@ -121,6 +130,39 @@ public:
     /** \brief options for reliability
      */
     LpReliability::Options reliabilityOptions;
+
+    /** \brief enables active queue management of outgoing packets
+     *
+     *  The send queue is above target when the send-queue delay reported by the transport is
+     *  at least \p congestionTarget, or its send-queue length is at least
+     *  \p congestionThreshold. When it has stayed above target for at least
+     *  \p congestionInterval, outgoing Interests, Data, and Nacks are marked with
+     *  CongestionMark (or dropped, if \p dropOnCongestion is set) at a rate that increases
+     *  with the square root of the number of signals, as in CoDel (RFC 8289).
+     */
+    bool allowCongestionMarking;
+
+    /** \brief acceptable standing send-queue delay
+     *
+     *  This applies to transports that keep their own send queue, such as TCP.
+     */
+    time::nanoseconds congestionTarget;
+
+    /** \brief acceptable standing send-queue length in octets
+     *
+     *  This applies to transports that report the kernel backlog of their socket,
+     *  such as UDP and Ethernet.
+     */
+    size_t congestionThreshold;
+
+    /** \brief how long the send queue must stay above target before congestion is signaled,
+     *         and the initial spacing between congestion signals
+     */
+    time::nanoseconds congestionInterval;
+
+    /** \brief drop outgoing packets instead of marking them when congestion is signaled
+     */
+    bool dropOnCongestion;
   };
 
   /** \brief counters provided by GenericLinkService
@@ -178,6 +220,40 @@ private: // send path
   void
   encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
 
+  /** \brief send a network layer packet that needs no per-link fields, using a shared encoding
+   *  \param netPkt network layer packet to extract tags from
+   *  \param wire wire encoding of \p netPkt
+   *  \return whether the packet has been sent; false if \p netPkt is not in a
+   *          SharedEncodingScope, or if it needs fragmentation or exceeds MTU
+   *  \pre reliability is disabled
+   *
+   *  The encoding is stored in the SharedEncodingTag of \p netPkt, and is shared with other
+   *  GenericLinkService instances with the same allowLocalFields option that send the same
+   *  packet object in the same scope.
+   */
+  bool
+  sendSharedNetPacket(const ndn::PacketBase& netPkt, const Block& wire);
+
+  /** \brief run the CoDel control law against the current send-queue delay and length
+   *  \return whether a congestion signal should be applied to the outgoing packet
+   */
+  bool
+  checkCongestion(time::steady_clock::TimePoint now);
+
+  /** \brief action of active queue management on an outgoing packet
+   */
+  enum class CongestionAction {
+    NONE, ///< send the packet unchanged
+    MARK, ///< send the packet with CongestionMark
+    DROP  ///< drop the packet
+  };
+
+  /** \brief decide the action of active queue management on the next outgoing packet,
+   *         and count it
+   */
+  CongestionAction
+  decideCongestionAction();
+
   /** \brief send a complete network layer packet
    *  \param pkt LpPacket containing a complete network layer packet
    *  \param isInterest whether the network layer packet is an Interest
@@ -254,6 +330,18 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   LpReliability m_reliability;
   lp::Sequence m_lastSeqNo;
 
+  /** \brief when the send queue first rose above target,
+   *         or time::steady_clock::TimePoint::min() if it is below target
+   */
+  time::steady_clock::TimePoint m_firstAboveTargetTime;
+  /** \brief when the next congestion signal is due, while in congested state
+   */
+  time::steady_clock::TimePoint m_nextCongestionSignalTime;
+  /** \brief number of congestion signals in the current (or last) congested episode
+   */
+  size_t m_nCongestionSignals;
+  bool m_isCongested;
+
   friend class LpReliability;
 };
 
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "io-thread.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT("IoThread");
+
+static shared_ptr<IoThread> g_ioThread;
+
+IoThread::IoThread()
+  : m_work(make_unique<boost::asio::io_service::work>(m_ioService))
+  , m_thread([this] { m_ioService.run(); })
+{
+  NFD_LOG_INFO("Started I/O thread");
+}
+
+IoThread::~IoThread()
+{
+  m_work.reset();
+  m_ioService.stop();
+  m_thread.join();
+  NFD_LOG_INFO("Stopped I/O thread");
+}
+
+shared_ptr<IoThread>
+getIoThread()
+{
+  return g_ioThread;
+}
+
+void
+setIoThread(shared_ptr<IoThread> ioThread)
+{
+  g_ioThread = std::move(ioThread);
+}
+
+} // namespace face
+} // namespace nfd
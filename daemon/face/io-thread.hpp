@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_IO_THREAD_HPP
+#define NFD_DAEMON_FACE_IO_THREAD_HPP
+
+#include "core/common.hpp"
+
+// boost::thread is used instead of std::thread to guarantee proper cleanup of thread local storage
+#include <boost/thread.hpp>
+
+namespace nfd {
+namespace face {
+
+/** \brief a thread dedicated to socket receive operations
+ *
+ *  Transports that support it receive datagrams on this thread and hand them over to the
+ *  forwarding thread through a bounded lock-free ring, so that system calls and packet copies
+ *  are taken off the forwarding thread. Packet decoding and all table accesses remain on the
+ *  forwarding thread.
+ */
+class IoThread : noncopyable
+{
+public:
+  /** \brief start the thread
+   */
+  IoThread();
+
+  /** \brief stop the thread and wait for it to exit
+   *
+   *  Transports hold a shared_ptr to the IoThread they use, so no socket can be left
+   *  associated with the io_service when it is destroyed.
+   */
+  ~IoThread();
+
+  boost::asio::io_service&
+  getIoService()
+  {
+    return m_ioService;
+  }
+
+private:
+  boost::asio::io_service m_ioService;
+  unique_ptr<boost::asio::io_service::work> m_work;
+  boost::thread m_thread;
+};
+
+/** \return the IoThread used by newly created transports,
+ *          or nullptr if they should receive on the forwarding thread
+ *  \note This must be called on the forwarding thread.
+ */
+shared_ptr<IoThread>
+getIoThread();
+
+/** \brief set the IoThread used by newly created transports
+ *  \param ioThread the IoThread, or nullptr to receive on the forwarding thread
+ *
+ *  Existing transports are unaffected.
+ */
+void
+setIoThread(shared_ptr<IoThread> ioThread);
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_IO_THREAD_HPP
@@ -79,6 +79,12 @@ LpFragmenter::getLinkService() const
   return m_linkService;
 }
 
+bool
+LpFragmenter::needsFragmentation(size_t lpPacketSize, size_t mtu)
+{
+  return MAX_SINGLE_FRAG_OVERHEAD + lpPacketSize > mtu;
+}
+
 std::tuple<bool, std::vector<lp::Packet>>
 LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
 {
@@ -86,7 +92,7 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
   BOOST_ASSERT(!packet.has<lp::FragIndexField>());
   BOOST_ASSERT(!packet.has<lp::FragCountField>());
 
-  if (MAX_SINGLE_FRAG_OVERHEAD + packet.wireEncode().size() <= mtu) {
+  if (!needsFragmentation(packet.wireEncode().size(), mtu)) {
     // fast path: fragmentation not needed
     // To qualify for fast path, the packet must have space for adding a sequence number,
     // because another NDNLPv2 feature may require the sequence number.
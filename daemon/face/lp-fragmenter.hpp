@@ -78,6 +78,13 @@ public:
   std::tuple<bool, std::vector<lp::Packet>>
   fragmentPacket(const lp::Packet& packet, size_t mtu);
 
+  /** \return whether an LpPacket of \p lpPacketSize octets must be fragmented to fit in \p mtu
+   *
+   *  If fragmentation is not needed, fragmentPacket returns the LpPacket unchanged.
+   */
+  static bool
+  needsFragmentation(size_t lpPacketSize, size_t mtu);
+
 private:
   Options m_options;
   const LinkService* m_linkService;
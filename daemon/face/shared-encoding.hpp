@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_SHARED_ENCODING_HPP
+#define NFD_DAEMON_FACE_SHARED_ENCODING_HPP
+
+#include "core/common.hpp"
+#include <ndn-cxx/packet-base.hpp>
+
+#include <array>
+
+namespace nfd {
+namespace face {
+
+/** \brief LpPacket encodings of one network layer packet, shared among the faces it is sent to
+ *
+ *  This tag is attached by SharedEncodingScope. It applies only to the packet object given to
+ *  the scope: a copy of that packet carries the same tag, but may have been modified, and
+ *  therefore does not use the encodings.
+ */
+class SharedEncodingTag : public ndn::Tag
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 21;
+  }
+
+  explicit
+  SharedEncodingTag(const ndn::PacketBase& netPkt)
+    : m_netPkt(&netPkt)
+  {
+  }
+
+  /** \return whether the encodings in this tag apply to \p netPkt
+   */
+  bool
+  isFor(const ndn::PacketBase& netPkt) const
+  {
+    return &netPkt == m_netPkt;
+  }
+
+  /** \return the LpPacket encoding for the given allowLocalFields option;
+   *          an empty Block if it has not been encoded
+   */
+  Block&
+  getLpPacket(bool allowLocalFields)
+  {
+    return m_lpPkts[allowLocalFields];
+  }
+
+private:
+  const ndn::PacketBase* m_netPkt;
+  std::array<Block, 2> m_lpPkts;
+};
+
+/** \brief shares the LpPacket encoding of a packet among the faces it is sent to in this scope
+ *
+ *  The forwarding pipelines and strategies create a scope around a loop that sends the same
+ *  packet to many faces, such as a Data to every pending downstream or an Interest to every
+ *  multicast nexthop. GenericLinkService then encodes the packet into an LpPacket on the first
+ *  face, and transmits the same buffer on the other faces. The encodings are released when the
+ *  scope ends.
+ *
+ *  \pre the packet and its other tags are not modified while the scope exists
+ */
+class SharedEncodingScope : noncopyable
+{
+public:
+  explicit
+  SharedEncodingScope(const ndn::PacketBase& netPkt)
+    : m_netPkt(netPkt)
+  {
+    m_netPkt.setTag(make_shared<SharedEncodingTag>(m_netPkt));
+  }
+
+  ~SharedEncodingScope()
+  {
+    m_netPkt.removeTag<SharedEncodingTag>();
+  }
+
+private:
+  const ndn::PacketBase& m_netPkt;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_SHARED_ENCODING_HPP
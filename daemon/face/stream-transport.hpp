@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_STREAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
 #include <queue>
@@ -51,6 +52,12 @@ public:
   explicit
   StreamTransport(typename protocol::socket&& socket);
 
+  time::nanoseconds
+  getSendQueueDelay() const override;
+
+  size_t
+  getSendQueueLength() override;
+
 protected:
   void
   doClose() override;
@@ -93,9 +100,18 @@ protected:
   NFD_LOG_INCLASS_DECLARE();
 
 private:
+  /** \brief an outgoing packet waiting in the send queue
+   */
+  struct QueuedPacket
+  {
+    Block packet;
+    time::steady_clock::TimePoint enqueueTime;
+  };
+
   uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
   size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
+  std::queue<QueuedPacket> m_sendQueue;
+  size_t m_sendQueueBytes;
 };
 
 
@@ -103,10 +119,32 @@ template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
   , m_receiveBufferSize(0)
+  , m_sendQueueBytes(0)
 {
   startReceive();
 }
 
+template<class T>
+time::nanoseconds
+StreamTransport<T>::getSendQueueDelay() const
+{
+  if (m_sendQueue.empty()) {
+    return time::nanoseconds::zero();
+  }
+  return time::steady_clock::now() - m_sendQueue.front().enqueueTime;
+}
+
+template<class T>
+size_t
+StreamTransport<T>::getSendQueueLength()
+{
+  size_t queueLength = m_sendQueueBytes;
+  if (m_socket.is_open()) {
+    queueLength += getTxQueueLength(m_socket.native_handle());
+  }
+  return queueLength;
+}
+
 template<class T>
 void
 StreamTransport<T>::doClose()
@@ -164,7 +202,8 @@ StreamTransport<T>::doSend(Transport::Packet&& packet)
     return;
 
   bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet.packet);
+  m_sendQueue.push({packet.packet, time::steady_clock::now()});
+  m_sendQueueBytes += packet.packet.size();
 
   if (wasQueueEmpty)
     sendFromQueue();
@@ -174,7 +213,7 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front().packet),
                            bind(&StreamTransport<T>::handleSend, this,
                                 boost::asio::placeholders::error,
                                 boost::asio::placeholders::bytes_transferred));
@@ -191,6 +230,8 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
 
   BOOST_ASSERT(!m_sendQueue.empty());
+  this->sendQueueSojournTime += time::steady_clock::now() - m_sendQueue.front().enqueueTime;
+  m_sendQueueBytes -= m_sendQueue.front().packet.size();
   m_sendQueue.pop();
 
   if (!m_sendQueue.empty())
@@ -297,8 +338,9 @@ template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
+  std::queue<QueuedPacket> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
+  m_sendQueueBytes = 0;
 }
 
 } // namespace face
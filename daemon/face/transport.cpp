@@ -170,6 +170,18 @@ Transport::afterChangePersistency(ndn::nfd::FacePersistency oldPersistency)
 {
 }
 
+time::nanoseconds
+Transport::getSendQueueDelay() const
+{
+  return time::nanoseconds::zero();
+}
+
+size_t
+Transport::getSendQueueLength()
+{
+  return 0;
+}
+
 void
 Transport::setState(TransportState newState)
 {
@@ -88,6 +88,14 @@ public:
    *  This counter is increased only if transport is UP.
    */
   ByteCounter nOutBytes;
+
+  /** \brief total time outgoing packets have spent in the send queue
+   *
+   *  Only a transport that keeps its own send queue (such as a stream-based transport)
+   *  updates this counter, when a packet leaves the queue.
+   *  Divided by nOutPackets, it gives the mean sojourn time of outgoing packets.
+   */
+  DurationCounter sendQueueSojournTime;
 };
 
 /** \brief indicates the transport has no limit on payload size
@@ -270,6 +278,26 @@ public: // dynamic properties
   time::steady_clock::TimePoint
   getExpirationTime() const;
 
+  /** \return how long the packet at the head of the send queue has been waiting
+   *  \retval time::nanoseconds::zero() the send queue is empty, or the transport does not
+   *                                    keep its own send queue
+   *
+   *  The base class implementation returns zero.
+   */
+  virtual time::nanoseconds
+  getSendQueueDelay() const;
+
+  /** \return number of octets waiting to be transmitted, in the transport's own send queue
+   *          and in the kernel send buffer of its socket
+   *  \retval 0 nothing is waiting, or the transport cannot determine the backlog
+   *
+   *  This reports the backlog of transports that hand packets to the kernel immediately,
+   *  such as UDP and Ethernet, for which getSendQueueDelay() is always zero.
+   *  The base class implementation returns zero.
+   */
+  virtual size_t
+  getSendQueueLength();
+
 protected: // properties to be set by subclass
   void
   setLocalUri(const FaceUri& uri);
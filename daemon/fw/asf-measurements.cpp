@@ -65,21 +65,22 @@ RttStats::computeSrtt(Rtt previousSrtt, Rtt currentRtt)
 ////////////////////////////////////////////////////////////////////////////////
 
 FaceInfo::FaceInfo()
-  : m_isTimeoutScheduled(false)
+  : m_measurementExpirationTime(time::steady_clock::TimePoint::min())
+  , m_timeoutId(0)
+  , m_isTimeoutScheduled(false)
 {
 }
 
 FaceInfo::~FaceInfo()
 {
-  cancelTimeoutEvent();
   scheduler::cancel(m_measurementExpirationId);
 }
 
 void
-FaceInfo::setTimeoutEvent(const scheduler::EventId& id, const Name& interestName)
+FaceInfo::setTimeout(uint64_t timeoutId, const Name& interestName)
 {
   if (!m_isTimeoutScheduled) {
-    m_timeoutEventId = id;
+    m_timeoutId = timeoutId;
     m_isTimeoutScheduled = true;
     m_lastInterestName = interestName;
   }
@@ -91,7 +92,7 @@ FaceInfo::setTimeoutEvent(const scheduler::EventId& id, const Name& interestName
 void
 FaceInfo::cancelTimeoutEvent()
 {
-  scheduler::cancel(m_timeoutEventId);
+  // the entry in the strategy's timeout queue is skipped when it no longer matches m_timeoutId
   m_isTimeoutScheduled = false;
 }
 
@@ -137,12 +138,22 @@ FaceInfo::recordTimeout(const Name& interestName)
   cancelTimeoutEvent(interestName);
 }
 
+void
+FaceInfo::recordScheduledTimeout()
+{
+  BOOST_ASSERT(isTimeoutScheduled());
+  m_rttStats.recordTimeout();
+  cancelTimeoutEvent();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
 NamespaceInfo::NamespaceInfo()
-  : m_isProbingDue(false)
+  : m_handle(make_shared<bool>(), this)
+  , m_isProbingDue(false)
   , m_hasFirstProbeBeenScheduled(false)
+  , m_nextProbeTime(time::steady_clock::TimePoint::max())
 {
 }
 
@@ -182,20 +193,39 @@ NamespaceInfo::getOrCreateFaceInfo(const fib::Entry& fibEntry, const Face& face)
 void
 NamespaceInfo::expireFaceInfo(nfd::face::FaceId faceId)
 {
-  m_fit.erase(faceId);
+  FaceInfoTable::iterator it = m_fit.find(faceId);
+  if (it == m_fit.end()) {
+    return;
+  }
+
+  // The lifetime may have been extended since the event was scheduled
+  time::steady_clock::Duration remaining = it->second.getMeasurementExpirationTime() -
+                                           time::steady_clock::now();
+  if (remaining > time::steady_clock::Duration::zero()) {
+    scheduler::EventId id = scheduler::schedule(remaining,
+      bind(&NamespaceInfo::expireFaceInfo, this, faceId));
+    it->second.setMeasurementExpirationEventId(id);
+    return;
+  }
+
+  m_fit.erase(it);
 }
 
 void
 NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, const Face& face)
 {
-  // Cancel previous expiration
-  scheduler::cancel(info.getMeasurementExpirationEventId());
-
-  // Refresh measurement
-  scheduler::EventId id = scheduler::schedule(AsfMeasurements::MEASUREMENTS_LIFETIME,
-    bind(&NamespaceInfo::expireFaceInfo, this, face.getId()));
-
-  info.setMeasurementExpirationEventId(id);
+  bool isExpirationScheduled = info.getMeasurementExpirationTime() !=
+                               time::steady_clock::TimePoint::min();
+  info.setMeasurementExpirationTime(time::steady_clock::now() +
+                                    AsfMeasurements::MEASUREMENTS_LIFETIME);
+
+  // This is called for every forwarded Interest, so the expiration event is not rescheduled
+  // here; expireFaceInfo postpones itself if the lifetime has been extended in the meantime.
+  if (!isExpirationScheduled) {
+    scheduler::EventId id = scheduler::schedule(AsfMeasurements::MEASUREMENTS_LIFETIME,
+      bind(&NamespaceInfo::expireFaceInfo, this, face.getId()));
+    info.setMeasurementExpirationEventId(id);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -106,8 +106,21 @@ public:
 
   ~FaceInfo();
 
+  /** \brief mark a timeout as pending for the Interest forwarded to this face
+   *  \param timeoutId identifies the pending timeout in the strategy's timeout queue
+   *  \throw Error a timeout is already pending
+   */
   void
-  setTimeoutEvent(const scheduler::EventId& id, const Name& interestName);
+  setTimeout(uint64_t timeoutId, const Name& interestName);
+
+  /** \return identifier of the pending timeout
+   *  \pre isTimeoutScheduled()
+   */
+  uint64_t
+  getTimeoutId() const
+  {
+    return m_timeoutId;
+  }
 
   void
   setMeasurementExpirationEventId(const scheduler::EventId& id)
@@ -121,6 +134,21 @@ public:
     return m_measurementExpirationId;
   }
 
+  /** \return time when the measurements of this face expire, or TimePoint::min() if
+   *          the expiration has never been scheduled
+   */
+  time::steady_clock::TimePoint
+  getMeasurementExpirationTime() const
+  {
+    return m_measurementExpirationTime;
+  }
+
+  void
+  setMeasurementExpirationTime(time::steady_clock::TimePoint expirationTime)
+  {
+    m_measurementExpirationTime = expirationTime;
+  }
+
   void
   cancelTimeoutEvent(const Name& prefix);
 
@@ -136,6 +164,12 @@ public:
   void
   recordTimeout(const Name& interestName);
 
+  /** \brief record a timeout of the last Interest, and clear the scheduled timeout
+   *  \pre isTimeoutScheduled()
+   */
+  void
+  recordScheduledTimeout();
+
   bool
   isTimeout() const
   {
@@ -179,9 +213,10 @@ private:
 
   // Timeout associated with measurement
   scheduler::EventId m_measurementExpirationId;
+  time::steady_clock::TimePoint m_measurementExpirationTime;
 
   // RTO associated with Interest
-  scheduler::EventId m_timeoutEventId;
+  uint64_t m_timeoutId;
   bool m_isTimeoutScheduled;
 };
 
@@ -192,11 +227,21 @@ typedef std::unordered_map<face::FaceId, FaceInfo> FaceInfoTable;
 
 /** \brief stores stategy information about each face in this namespace
  */
-class NamespaceInfo : public StrategyInfo
+class NamespaceInfo : public StrategyInfo, noncopyable
 {
 public:
   NamespaceInfo();
 
+  /** \return a non-owning reference that expires when this NamespaceInfo is destroyed
+   *
+   *  Copying the returned handle does not allocate memory.
+   */
+  weak_ptr<NamespaceInfo>
+  getHandle()
+  {
+    return m_handle;
+  }
+
   static constexpr int
   getTypeId()
   {
@@ -269,11 +314,30 @@ public:
     m_hasFirstProbeBeenScheduled = hasBeenScheduled;
   }
 
+  /** \return the earliest time at which probing may become due
+   */
+  time::steady_clock::TimePoint
+  getNextProbeTime() const
+  {
+    return m_nextProbeTime;
+  }
+
+  void
+  setNextProbeTime(const time::steady_clock::TimePoint& nextProbeTime)
+  {
+    m_nextProbeTime = nextProbeTime;
+  }
+
 private:
   FaceInfoTable m_fit;
 
+  /** \brief points to this NamespaceInfo, but shares ownership of an unrelated token only
+   */
+  shared_ptr<NamespaceInfo> m_handle;
+
   bool m_isProbingDue;
   bool m_hasFirstProbeBeenScheduled;
+  time::steady_clock::TimePoint m_nextProbeTime;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
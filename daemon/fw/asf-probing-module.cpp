@@ -36,32 +36,13 @@ constexpr time::seconds ProbingModule::DEFAULT_PROBING_INTERVAL;
 static_assert(ProbingModule::DEFAULT_PROBING_INTERVAL < AsfMeasurements::MEASUREMENTS_LIFETIME,
               "ProbingModule::DEFAULT_PROBING_INTERVAL must be less than AsfMeasurements::MEASUREMENTS_LIFETIME");
 
-ProbingModule::ProbingModule(AsfMeasurements& measurements)
+ProbingModule::ProbingModule(AsfMeasurements& measurements, ProbingBudget& budget)
   : m_probingInterval(DEFAULT_PROBING_INTERVAL)
   , m_measurements(measurements)
+  , m_budget(budget)
 {
 }
 
-void
-ProbingModule::scheduleProbe(const fib::Entry& fibEntry, const time::milliseconds& interval)
-{
-  Name prefix = fibEntry.getPrefix();
-
-  // Set the probing flag for the namespace to true after passed interval of time
-  scheduler::schedule(interval, [this, prefix] {
-    NamespaceInfo* info = m_measurements.getNamespaceInfo(prefix);
-
-    if (info == nullptr) {
-      // fib::Entry with the passed prefix has been removed or the fib::Entry has
-      // a name that is not controlled by the AsfStrategy
-      return;
-    }
-    else {
-      info->setIsProbingDue(true);
-    }
-  });
-}
-
 Face*
 ProbingModule::getFaceToProbe(const Face& inFace,
                               const Interest& interest,
@@ -116,15 +97,22 @@ ProbingModule::isProbingNeeded(const fib::Entry& fibEntry, const Interest& inter
   // Return the probing status flag for a namespace
   NamespaceInfo& info = m_measurements.getOrCreateNamespaceInfo(fibEntry, interest);
 
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
   // If a first probe has not been scheduled for a namespace
   if (!info.isFirstProbeScheduled()) {
     // Schedule first probe between 0 and 5 seconds
     uint64_t interval = getRandomNumber(0, 5000);
-    scheduleProbe(fibEntry, time::milliseconds(interval));
+    info.setNextProbeTime(now + time::milliseconds(interval));
 
     info.setHasFirstProbeBeenScheduled(true);
   }
 
+  // An eligible namespace competes for the budget on every Interest, until it gets a probe
+  if (!info.isProbingDue() && info.getNextProbeTime() <= now && m_budget.consume()) {
+    info.setIsProbingDue(true);
+  }
+
   return info.isProbingDue();
 }
 
@@ -136,7 +124,7 @@ ProbingModule::afterForwardingProbe(const fib::Entry& fibEntry, const Interest&
   NamespaceInfo& info = m_measurements.getOrCreateNamespaceInfo(fibEntry, interest);
   info.setIsProbingDue(false);
 
-  scheduleProbe(fibEntry, m_probingInterval);
+  info.setNextProbeTime(time::steady_clock::now() + m_probingInterval);
 }
 
 Face*
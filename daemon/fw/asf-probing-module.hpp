@@ -27,21 +27,23 @@
 #define NFD_DAEMON_FW_ASF_PROBING_MODULE_HPP
 
 #include "asf-measurements.hpp"
+#include "fw/probing-budget.hpp"
 
 namespace nfd {
 namespace fw {
 namespace asf {
 
 /** \brief ASF Probing Module
+ *
+ *  A namespace becomes eligible for probing once per probing interval. Probes of all namespaces
+ *  share the ProbingBudget of the forwarder. An eligible namespace takes a probe from the budget
+ *  when it receives an Interest, so busier namespaces get a larger share of the budget when it
+ *  is scarce, and no per-namespace timer is needed.
  */
 class ProbingModule
 {
 public:
-  explicit
-  ProbingModule(AsfMeasurements& measurements);
-
-  void
-  scheduleProbe(const fib::Entry& fibEntry, const time::milliseconds& interval);
+  ProbingModule(AsfMeasurements& measurements, ProbingBudget& budget);
 
   Face*
   getFaceToProbe(const Face& inFace,
@@ -76,6 +78,7 @@ public:
 private:
   time::seconds m_probingInterval;
   AsfMeasurements& m_measurements;
+  ProbingBudget& m_budget;
 };
 
 } // namespace asf
@@ -41,7 +41,9 @@ const time::milliseconds AsfStrategy::RETX_SUPPRESSION_MAX(250);
 AsfStrategy::AsfStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder)
   , m_measurements(getMeasurements())
-  , m_probing(m_measurements)
+  , m_probing(m_measurements, forwarder.getProbingBudget())
+  , m_lastTimeoutId(0)
+  , m_timeoutEventDeadline(time::steady_clock::TimePoint::max())
   , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
                       RetxSuppressionExponential::DEFAULT_MULTIPLIER,
                       RETX_SUPPRESSION_MAX)
@@ -183,13 +185,62 @@ AsfStrategy::forwardInterest(const Interest& interest,
                                             << " FaceId: " << outFace.getId()
                                             << " in " << time::duration_cast<time::milliseconds>(timeout) << " ms");
 
-    scheduler::EventId id = scheduler::schedule(timeout,
-        bind(&AsfStrategy::onTimeout, this, interest.getName(), outFace.getId()));
+    scheduleTimeout(namespaceInfo, faceInfo, interest.getName(), outFace.getId(), timeout);
+  }
+}
+
+void
+AsfStrategy::scheduleTimeout(NamespaceInfo& namespaceInfo, FaceInfo& faceInfo,
+                             const Name& interestName, face::FaceId faceId,
+                             RttEstimator::Duration timeout)
+{
+  uint64_t timeoutId = ++m_lastTimeoutId;
+  faceInfo.setTimeout(timeoutId, interestName);
+
+  time::steady_clock::TimePoint deadline = time::steady_clock::now() +
+    time::duration_cast<time::steady_clock::Duration>(timeout);
+  m_timeouts.push({deadline, namespaceInfo.getHandle(), faceId, timeoutId});
+
+  // the scheduler is touched only if this timeout expires before all pending ones
+  if (deadline < m_timeoutEventDeadline) {
+    armTimeoutEvent();
+  }
+}
 
-    faceInfo.setTimeoutEvent(id, interest.getName());
+void
+AsfStrategy::processTimeouts()
+{
+  m_timeoutEventDeadline = time::steady_clock::TimePoint::max();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  while (!m_timeouts.empty() && m_timeouts.top().deadline <= now) {
+    // priority_queue::top is const, but the item is popped right away
+    PendingTimeout timeout = std::move(const_cast<PendingTimeout&>(m_timeouts.top()));
+    m_timeouts.pop();
+
+    shared_ptr<NamespaceInfo> namespaceInfo = timeout.namespaceInfo.lock();
+    FaceInfo* faceInfo = namespaceInfo == nullptr ? nullptr : namespaceInfo->get(timeout.faceId);
+    if (faceInfo != nullptr && faceInfo->isTimeoutScheduled() &&
+        faceInfo->getTimeoutId() == timeout.timeoutId) {
+      NFD_LOG_TRACE("FaceId: " << timeout.faceId << " has timed-out");
+      faceInfo->recordScheduledTimeout();
+    }
+  }
+
+  if (!m_timeouts.empty()) {
+    armTimeoutEvent();
   }
 }
 
+void
+AsfStrategy::armTimeoutEvent()
+{
+  BOOST_ASSERT(!m_timeouts.empty());
+  m_timeoutEventDeadline = m_timeouts.top().deadline;
+  m_timeoutEvent = scheduler::schedule(m_timeoutEventDeadline - time::steady_clock::now(),
+                                       bind(&AsfStrategy::processTimeouts, this));
+}
+
 struct FaceStats
 {
   Face* face;
@@ -31,6 +31,8 @@
 #include "fw/retx-suppression-exponential.hpp"
 #include "fw/strategy.hpp"
 
+#include <queue>
+
 namespace nfd {
 namespace fw {
 namespace asf {
@@ -40,6 +42,9 @@ namespace asf {
  *  \see Vince Lehman, Ashlesh Gawande, Rodrigo Aldecoa, Dmitri Krioukov, Beichuan Zhang, Lixia Zhang, and Lan Wang,
  *       "An Experimental Investigation of Hyperbolic Routing with a Smart Forwarding Plane in NDN,"
  *       NDN Technical Report NDN-0042, 2016. http://named-data.net/techreports.html
+ *
+ *  Probes are limited by the ProbingBudget of the forwarder, which is configured by the
+ *  probing_budget option in the tables section of the configuration file.
  */
 class AsfStrategy : public Strategy
 {
@@ -77,6 +82,22 @@ private:
   void
   onTimeout(const Name& interestName, face::FaceId faceId);
 
+  /** \brief add a timeout for \p faceInfo to the timeout queue
+   */
+  void
+  scheduleTimeout(NamespaceInfo& namespaceInfo, FaceInfo& faceInfo, const Name& interestName,
+                  face::FaceId faceId, RttEstimator::Duration timeout);
+
+  /** \brief process all timeouts whose deadline has been reached
+   */
+  void
+  processTimeouts();
+
+  /** \brief arm the timeout event for the earliest pending deadline
+   */
+  void
+  armTimeoutEvent();
+
   void
   sendNoRouteNack(const Face& inFace, const Interest& interest, const shared_ptr<pit::Entry>& pitEntry);
 
@@ -84,6 +105,34 @@ private:
   AsfMeasurements m_measurements;
   ProbingModule m_probing;
 
+  struct PendingTimeout
+  {
+    time::steady_clock::TimePoint deadline;
+    weak_ptr<NamespaceInfo> namespaceInfo;
+    face::FaceId faceId;
+    uint64_t timeoutId;
+  };
+
+  struct PendingTimeoutIsLater
+  {
+    bool
+    operator()(const PendingTimeout& a, const PendingTimeout& b) const
+    {
+      return a.deadline > b.deadline;
+    }
+  };
+
+  /** \brief timeouts of all faces in all namespaces, earliest deadline on top
+   *
+   *  A single scheduler event is armed for the earliest deadline. A timeout cancelled by
+   *  Data stays in the queue, and is skipped when its timeoutId no longer matches the FaceInfo.
+   *  The Interest name is kept in the FaceInfo only, so that queueing does not copy it.
+   */
+  std::priority_queue<PendingTimeout, std::vector<PendingTimeout>, PendingTimeoutIsLater> m_timeouts;
+  uint64_t m_lastTimeoutId;
+  scheduler::ScopedEventId m_timeoutEvent;
+  time::steady_clock::TimePoint m_timeoutEventDeadline;
+
 private:
   RetxSuppressionExponential m_retxSuppression;
 
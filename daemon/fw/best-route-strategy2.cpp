@@ -100,19 +100,43 @@ isNextHopEligible(const Face& inFace, const Interest& interest,
   return true;
 }
 
+/** \brief pick the eligible NextHop with lowest cost
+ *
+ *  Nexthops whose face is not up are skipped using the bitmask in the FIB entry,
+ *  before the face of the nexthop is accessed.
+ */
+static inline fib::NextHopList::const_iterator
+findEligibleNextHop(const Face& inFace, const Interest& interest,
+                    const fib::Entry& fibEntry,
+                    const shared_ptr<pit::Entry>& pitEntry,
+                    bool wantUnused = false,
+                    time::steady_clock::TimePoint now = time::steady_clock::TimePoint::min())
+{
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+  for (size_t i = 0; i < nexthops.size(); ++i) {
+    if (fibEntry.isNextHopUsable(i) &&
+        isNextHopEligible(inFace, interest, nexthops[i], pitEntry, wantUnused, now)) {
+      return nexthops.begin() + i;
+    }
+  }
+  return nexthops.end();
+}
+
 /** \brief pick an eligible NextHop with earliest out-record
  *  \note It is assumed that every nexthop has an out-record.
  */
 static inline fib::NextHopList::const_iterator
 findEligibleNextHopWithEarliestOutRecord(const Face& inFace, const Interest& interest,
-                                         const fib::NextHopList& nexthops,
+                                         const fib::Entry& fibEntry,
                                          const shared_ptr<pit::Entry>& pitEntry)
 {
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
   size_t current_size = LLONG_MAX;
   fib::NextHopList::const_iterator found = nexthops.end();
   time::steady_clock::TimePoint earliestRenewed = time::steady_clock::TimePoint::max();
   for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
-    if (!isNextHopEligible(inFace, interest, *it, pitEntry))
+    if (!fibEntry.isNextHopUsable(it - nexthops.begin()) ||
+        !isNextHopEligible(inFace, interest, *it, pitEntry))
       continue;
     pit::OutRecordCollection::iterator outRecord = pitEntry->getOutRecord(it->getFace());
     BOOST_ASSERT(outRecord != pitEntry->out_end());
@@ -145,9 +169,7 @@ BestRouteStrategy2::afterReceiveInterest(const Face& inFace, const Interest& int
   if (suppression == RetxSuppressionResult::NEW) {
     // forward to nexthop with lowest cost except downstream
    printf("suppression == RetxSuppressionResult::NEW\n"); 
-   it = std::find_if(nexthops.begin(), nexthops.end(),
-      bind(&isNextHopEligible, cref(inFace), interest, _1, pitEntry,
-           false, time::steady_clock::TimePoint::min()));
+   it = findEligibleNextHop(inFace, interest, fibEntry, pitEntry);
 
     if (it == nexthops.end()) {
       NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
@@ -171,9 +193,8 @@ BestRouteStrategy2::afterReceiveInterest(const Face& inFace, const Interest& int
   }
 
   // find an unused upstream with lowest cost except downstream
-  it = std::find_if(nexthops.begin(), nexthops.end(),
-                    bind(&isNextHopEligible, cref(inFace), interest, _1, pitEntry,
-                         true, time::steady_clock::now()));
+  it = findEligibleNextHop(inFace, interest, fibEntry, pitEntry,
+                           true, time::steady_clock::now());
   printf("find an unused upstream with lowest cost except downstream\n");
   if (it != nexthops.end()) {
     Face& outFace = it->getFace();
@@ -187,7 +208,7 @@ BestRouteStrategy2::afterReceiveInterest(const Face& inFace, const Interest& int
   }
 
   // find an eligible upstream that is used earliest
-  it = findEligibleNextHopWithEarliestOutRecord(inFace, interest, nexthops, pitEntry);
+  it = findEligibleNextHopWithEarliestOutRecord(inFace, interest, fibEntry, pitEntry);
   if (it == nexthops.end()) {
     NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmitNoNextHop");
   }
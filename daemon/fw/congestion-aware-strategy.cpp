@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "congestion-aware-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/logger.hpp"
+#include "core/random.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(CongestionAwareStrategy);
+
+NFD_LOG_INIT("CongestionAwareStrategy");
+
+const double CongestionAwareStrategy::WeightTable::INITIAL_WEIGHT = 10.0;
+const double CongestionAwareStrategy::WeightTable::MIN_WEIGHT = 1.0;
+const double CongestionAwareStrategy::WeightTable::MAX_WEIGHT = 100.0;
+const double CongestionAwareStrategy::WeightTable::ADDITIVE_INCREASE = 1.0;
+const double CongestionAwareStrategy::WeightTable::MULTIPLICATIVE_DECREASE = 0.5;
+
+const time::milliseconds CongestionAwareStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds CongestionAwareStrategy::RETX_SUPPRESSION_MAX(250);
+const time::seconds CongestionAwareStrategy::MEASUREMENTS_LIFETIME(300);
+
+double
+CongestionAwareStrategy::WeightTable::getWeight(FaceId faceId) const
+{
+  auto it = m_weights.find(faceId);
+  return it == m_weights.end() ? INITIAL_WEIGHT : it->second;
+}
+
+void
+CongestionAwareStrategy::WeightTable::increase(FaceId faceId)
+{
+  auto it = m_weights.insert({faceId, INITIAL_WEIGHT}).first;
+  it->second = std::min(it->second + ADDITIVE_INCREASE, MAX_WEIGHT);
+}
+
+void
+CongestionAwareStrategy::WeightTable::decrease(FaceId faceId)
+{
+  auto it = m_weights.insert({faceId, INITIAL_WEIGHT}).first;
+  it->second = std::max(it->second * MULTIPLICATIVE_DECREASE, MIN_WEIGHT);
+}
+
+CongestionAwareStrategy::CongestionAwareStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("CongestionAwareStrategy does not accept parameters"));
+  }
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "CongestionAwareStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+CongestionAwareStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/congestion-aware/%FD%01");
+  return strategyName;
+}
+
+void
+CongestionAwareStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                              const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppressResult = m_retxSuppression.decidePerPitEntry(*pitEntry);
+  if (suppressResult == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " suppressed");
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  const WeightTable& weights = this->getOrCreateWeightTable(fibEntry, interest);
+
+  Face* outFace = this->chooseNextHop(fibEntry, weights, inFace, interest);
+  if (outFace == nullptr) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, inFace, nackHeader);
+
+    this->rejectPendingInterest(pitEntry);
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " to=" << outFace->getId() <<
+                " weight=" << weights.getWeight(outFace->getId()));
+  this->sendInterest(pitEntry, *outFace, interest);
+}
+
+void
+CongestionAwareStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                               const Face& inFace, const Data& data)
+{
+  if (pitEntry->getOutRecord(inFace) == pitEntry->out_end()) {
+    return;
+  }
+
+  measurements::Entry* me = this->getMeasurements().findLongestPrefixMatch(*pitEntry,
+                              measurements::EntryWithStrategyInfo<WeightTable>());
+  if (me == nullptr) {
+    return;
+  }
+  WeightTable* weights = me->getStrategyInfo<WeightTable>();
+
+  if (data.getCongestionMark() > 0) {
+    weights->decrease(inFace.getId());
+    NFD_LOG_DEBUG(data.getName() << " from=" << inFace.getId() << " congestion-mark=" <<
+                  data.getCongestionMark() << " weight=" << weights->getWeight(inFace.getId()));
+  }
+  else {
+    weights->increase(inFace.getId());
+  }
+}
+
+void
+CongestionAwareStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                          const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (nack.getReason() != lp::NackReason::DUPLICATE) {
+    measurements::Entry* me = this->getMeasurements().findLongestPrefixMatch(*pitEntry,
+                                measurements::EntryWithStrategyInfo<WeightTable>());
+    if (me != nullptr) {
+      WeightTable* weights = me->getStrategyInfo<WeightTable>();
+      weights->decrease(inFace.getId());
+      NFD_LOG_DEBUG(nack.getInterest() << " from=" << inFace.getId() << " nack=" <<
+                    nack.getReason() << " weight=" << weights->getWeight(inFace.getId()));
+    }
+  }
+
+  this->processNack(inFace, nack, pitEntry);
+}
+
+CongestionAwareStrategy::WeightTable&
+CongestionAwareStrategy::getOrCreateWeightTable(const fib::Entry& fibEntry, const Interest& interest)
+{
+  measurements::Entry* me = this->getMeasurements().get(fibEntry);
+
+  // If the FIB entry is not under the strategy's namespace, find a part of the prefix
+  // that falls under the strategy's namespace
+  for (size_t prefixLen = fibEntry.getPrefix().size() + 1;
+       me == nullptr && prefixLen <= interest.getName().size(); ++prefixLen) {
+    me = this->getMeasurements().get(interest.getName().getPrefix(prefixLen));
+  }
+
+  // Either the FIB entry or the Interest's name must be under this strategy's namespace
+  BOOST_ASSERT(me != nullptr);
+
+  this->getMeasurements().extendLifetime(*me, MEASUREMENTS_LIFETIME);
+  return *me->insertStrategyInfo<WeightTable>().first;
+}
+
+Face*
+CongestionAwareStrategy::chooseNextHop(const fib::Entry& fibEntry, const WeightTable& weights,
+                                       const Face& inFace, const Interest& interest)
+{
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+
+  auto isEligible = [&] (size_t index) {
+    const Face& outFace = nexthops[index].getFace();
+    return fibEntry.isNextHopUsable(index) &&
+           !(outFace.getId() == inFace.getId() &&
+             outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) &&
+           !wouldViolateScope(inFace, interest, outFace);
+  };
+
+  // two passes over the nexthops, so that no per-Interest container is needed
+  double totalWeight = 0.0;
+  for (size_t i = 0; i < nexthops.size(); ++i) {
+    if (isEligible(i)) {
+      totalWeight += weights.getWeight(nexthops[i].getFace().getId());
+    }
+  }
+  if (totalWeight <= 0.0) {
+    return nullptr;
+  }
+
+  std::uniform_real_distribution<double> dist(0.0, totalWeight);
+  double point = dist(getGlobalRng());
+
+  Face* chosen = nullptr;
+  for (size_t i = 0; i < nexthops.size(); ++i) {
+    if (!isEligible(i)) {
+      continue;
+    }
+    chosen = &nexthops[i].getFace();
+    point -= weights.getWeight(chosen->getId());
+    if (point < 0.0) {
+      break;
+    }
+  }
+  return chosen;
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_CONGESTION_AWARE_STRATEGY_HPP
+#define NFD_DAEMON_FW_CONGESTION_AWARE_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief a forwarding strategy that splits Interests across nexthops according to
+ *         per-face weights, which adapt to congestion signals
+ *
+ *  Each Interest is forwarded to one nexthop, chosen at random with probability proportional
+ *  to the weight of its face. Weights are kept per namespace in measurements, and follow an
+ *  additive-increase multiplicative-decrease rule: Data without a congestion mark increases
+ *  the weight of the face it arrives on, while Data with a congestion mark, or a Nack other
+ *  than Duplicate, decreases it. Weights are bounded, so that a congested path still carries
+ *  some traffic and can recover.
+ *
+ *  \see Klaus Schneider, Cheng Yi, Beichuan Zhang, and Lixia Zhang,
+ *       "A Practical Congestion Control Scheme for Named Data Networking,"
+ *       ACM ICN 2016.
+ */
+class CongestionAwareStrategy : public Strategy
+                              , public ProcessNackTraits<CongestionAwareStrategy>
+{
+public:
+  /** \brief forwarding weights of nexthop faces in a namespace
+   */
+  class WeightTable : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1040;
+    }
+
+    /** \return weight of \p faceId, or INITIAL_WEIGHT if the face has no weight yet
+     */
+    double
+    getWeight(FaceId faceId) const;
+
+    /** \brief additively increase the weight of \p faceId, up to MAX_WEIGHT
+     */
+    void
+    increase(FaceId faceId);
+
+    /** \brief multiplicatively decrease the weight of \p faceId, down to MIN_WEIGHT
+     */
+    void
+    decrease(FaceId faceId);
+
+  public:
+    static const double INITIAL_WEIGHT;
+    static const double MIN_WEIGHT;
+    static const double MAX_WEIGHT;
+    static const double ADDITIVE_INCREASE;
+    static const double MULTIPLICATIVE_DECREASE;
+
+  private:
+    std::unordered_map<FaceId, double> m_weights;
+  };
+
+public:
+  explicit
+  CongestionAwareStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                        const Face& inFace, const Data& data) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+private:
+  /** \brief find or create the WeightTable for the namespace of \p interest
+   */
+  WeightTable&
+  getOrCreateWeightTable(const fib::Entry& fibEntry, const Interest& interest);
+
+  /** \brief choose a nexthop at random, in proportion to the weights of their faces
+   *  \return the face of the chosen nexthop, or nullptr if no nexthop is eligible
+   */
+  Face*
+  chooseNextHop(const fib::Entry& fibEntry, const WeightTable& weights,
+                const Face& inFace, const Interest& interest);
+
+private:
+  friend ProcessNackTraits<CongestionAwareStrategy>;
+  RetxSuppressionExponential m_retxSuppression;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+  static const time::seconds MEASUREMENTS_LIFETIME;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CONGESTION_AWARE_STRATEGY_HPP
@@ -28,6 +28,7 @@
 #include "best-route-strategy2.hpp"
 #include "strategy.hpp"
 #include "core/logger.hpp"
+#include "face/shared-encoding.hpp"
 #include "table/cleanup.hpp"
 #include <ndn-cxx/lp/tags.hpp>
 
@@ -35,6 +36,9 @@ namespace nfd {
 
 NFD_LOG_INIT("Forwarder");
 
+const time::nanoseconds Forwarder::DEFAULT_STRAGGLER_TIME = time::milliseconds(100);
+const size_t Forwarder::DEFAULT_INTEREST_BATCH_LIMIT = 1;
+
 static Name
 getDefaultStrategyName()
 {
@@ -45,13 +49,21 @@ Forwarder::Forwarder()
   : m_unsolicitedDataPolicy(new fw::DefaultUnsolicitedDataPolicy())
   , m_fib(m_nameTree)
   , m_pit(m_nameTree)
+  , m_pitExpiryTimers(bind(&Forwarder::onPitEntryExpired, this, _1))
   , m_measurements(m_nameTree)
   , m_strategyChoice(*this)
+  , m_stragglerTime(DEFAULT_STRAGGLER_TIME)
+  , m_interestBatchLimit(DEFAULT_INTEREST_BATCH_LIMIT)
 {
   m_faceTable.afterAdd.connect([this] (Face& face) {
     face.afterReceiveInterest.connect(
       [this, &face] (const Interest& interest) {
-        this->startProcessInterest(face, interest);
+        if (m_interestBatchLimit > 1) {
+          this->enqueueInterest(face, interest);
+        }
+        else {
+          this->startProcessInterest(face, interest);
+        }
       });
     face.afterReceiveData.connect(
       [this, &face] (const Data& data) {
@@ -65,6 +77,10 @@ Forwarder::Forwarder()
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(face, interest);
       });
+    face.afterStateChange.connect(
+      [this, &face] (face::FaceState, face::FaceState) {
+        m_fib.updateUsableNextHops(face);
+      });
   });
 
   m_faceTable.beforeRemove.connect([this] (Face& face) {
@@ -78,11 +94,24 @@ Forwarder::~Forwarder() = default;
 
 void
 Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
+{
+  if (!this->acceptIncomingInterest(inFace, interest)) {
+    return;
+  }
+
+  // PIT insert
+  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+
+  this->continueIncomingInterest(inFace, interest, pitEntry);
+}
+
+bool
+Forwarder::acceptIncomingInterest(Face& inFace, const Interest& interest)
 {
   // receive Interest
   NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() <<
                 " interest=" << interest.getName());
-  interest.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  interest.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInInterests;
 
   // /localhost scope control
@@ -92,7 +121,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() <<
                   " interest=" << interest.getName() << " violates /localhost");
     // (drop)
-    return;
+    return false;
   }
 
   // detect duplicate Nonce with Dead Nonce List
@@ -100,7 +129,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   if (hasDuplicateNonceInDnl) {
     // goto Interest loop pipeline
     this->onInterestLoop(inFace, interest);
-    return;
+    return false;
   }
 
   // strip forwarding hint if Interest has reached producer region
@@ -111,9 +140,13 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     const_cast<Interest&>(interest).setForwardingHint({});
   }
 
-  // PIT insert
-  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+  return true;
+}
 
+void
+Forwarder::continueIncomingInterest(Face& inFace, const Interest& interest,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
   // detect duplicate Nonce in PIT entry
   int dnw = fw::findDuplicateNonce(*pitEntry, interest.getNonce(), inFace);
   bool hasDuplicateNonceInPit = dnw != fw::DUPLICATE_NONCE_NONE;
@@ -141,6 +174,76 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
   }
 }
 
+void
+Forwarder::setInterestBatchLimit(size_t limit)
+{
+  BOOST_ASSERT(limit > 0);
+  m_interestBatchLimit = limit;
+  if (m_interestBatch.size() >= m_interestBatchLimit) {
+    this->processInterestBatch();
+  }
+}
+
+void
+Forwarder::enqueueInterest(Face& inFace, const Interest& interest)
+{
+  m_interestBatch.emplace_back(inFace.getId(), interest.shared_from_this());
+
+  if (m_interestBatch.size() >= m_interestBatchLimit) {
+    this->processInterestBatch();
+  }
+  else if (m_interestBatch.size() == 1) {
+    // process after I/O completions that are already pending have delivered their packets
+    m_interestBatchEvent = scheduler::schedule(time::nanoseconds::zero(),
+                                               bind(&Forwarder::processInterestBatch, this));
+  }
+}
+
+void
+Forwarder::processInterestBatch()
+{
+  m_interestBatchEvent.cancel();
+  std::vector<std::pair<FaceId, shared_ptr<const Interest>>> batch;
+  batch.swap(m_interestBatch);
+  NFD_LOG_TRACE("processInterestBatch size=" << batch.size());
+
+  struct Item
+  {
+    Face* face;
+    const Interest* interest;
+    shared_ptr<pit::Entry> pitEntry;
+  };
+  std::vector<Item> accepted;
+  accepted.reserve(batch.size());
+
+  // stage 1: scope control, Dead Nonce List, forwarding hint; prefetch NameTree buckets
+  for (const auto& faceAndInterest : batch) {
+    Face* inFace = m_faceTable.get(faceAndInterest.first);
+    if (inFace == nullptr) { // face has been closed while the Interest was queued
+      continue;
+    }
+    const Interest& interest = *faceAndInterest.second;
+    if (this->acceptIncomingInterest(*inFace, interest)) {
+      m_nameTree.prefetch(interest.getName());
+      accepted.push_back({inFace, &interest, nullptr});
+    }
+  }
+
+  // stage 2: PIT insert
+  for (Item& item : accepted) {
+    item.pitEntry = m_pit.insert(*item.interest).first;
+  }
+
+  // stage 3: PIT duplicate Nonce, CS lookup, strategy dispatch
+  for (Item& item : accepted) {
+    if (m_nameTree.getEntry(*item.pitEntry) == nullptr) {
+      // PIT entry has been erased while processing an earlier Interest in the batch
+      item.pitEntry = m_pit.insert(*item.interest).first;
+    }
+    this->continueIncomingInterest(*item.face, *item.interest, item.pitEntry);
+  }
+}
+
 void
 Forwarder::onInterestLoop(Face& inFace, const Interest& interest)
 {
@@ -202,7 +305,9 @@ Forwarder::onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& p
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
   ++m_counters.nCsHits;
 
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
+  static const shared_ptr<lp::IncomingFaceIdTag> contentStoreTag =
+    make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE);
+  data.setTag(contentStoreTag);
   // XXX should we lookup PIT for other Interests that also match csMatch?
 
   // set PIT straggler timer
@@ -276,7 +381,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 {
   // receive Data
   NFD_LOG_DEBUG("onIncomingData face=" << inFace.getId() << " data=" << data.getName());
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  data.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInData;
 
   // /localhost scope control
@@ -300,7 +405,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   // CS insert
   m_cs.insert(data);
 
-  std::set<Face*> pendingDownstreams;
+  std::vector<Face*> pendingDownstreams;
   // foreach PitEntry
   auto now = time::steady_clock::now();
   for (const shared_ptr<pit::Entry>& pitEntry : pitMatches) {
@@ -312,7 +417,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     // remember pending downstreams
     for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
       if (inRecord.getExpiry() > now) {
-        pendingDownstreams.insert(&inRecord.getFace());
+        pendingDownstreams.push_back(&inRecord.getFace());
       }
     }
 
@@ -331,7 +436,14 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     this->setStragglerTimer(pitEntry, true, data.getFreshnessPeriod());
   }
 
+  // a downstream may have in-records in several matching PIT entries
+  std::sort(pendingDownstreams.begin(), pendingDownstreams.end());
+  pendingDownstreams.erase(std::unique(pendingDownstreams.begin(), pendingDownstreams.end()),
+                           pendingDownstreams.end());
+
   // foreach pending downstream
+  // (GenericLinkService shares one encoding of the Data among all downstreams)
+  face::SharedEncodingScope sharedEncoding(data);
   for (Face* pendingDownstream : pendingDownstreams) {
     if (pendingDownstream->getId() == inFace.getId() &&
         pendingDownstream->getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
@@ -387,7 +499,7 @@ void
 Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
 {
   // receive Nack
-  nack.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  nack.setTag(inFace.getIncomingFaceIdTag());
   ++m_counters.nInNacks;
 
   // if multi-access or ad hoc face, drop
@@ -504,32 +616,40 @@ Forwarder::setUnsatisfyTimer(const shared_ptr<pit::Entry>& pitEntry)
     std::max_element(pitEntry->in_begin(), pitEntry->in_end(), &compare_InRecord_expiry);
 
   time::steady_clock::TimePoint lastExpiry = lastExpiring->getExpiry();
-  time::nanoseconds lastExpiryFromNow = lastExpiry - time::steady_clock::now();
-  if (lastExpiryFromNow <= time::seconds::zero()) {
+  if (lastExpiry <= time::steady_clock::now()) {
     // TODO all in-records are already expired; will this happen?
   }
 
-  scheduler::cancel(pitEntry->m_unsatisfyTimer);
-  pitEntry->m_unsatisfyTimer = scheduler::schedule(lastExpiryFromNow,
-    bind(&Forwarder::onInterestUnsatisfied, this, pitEntry));
+  pitEntry->m_isStraggler = false;
+  m_pitExpiryTimers.arm(*pitEntry, lastExpiry);
 }
 
 void
 Forwarder::setStragglerTimer(const shared_ptr<pit::Entry>& pitEntry, bool isSatisfied,
                              ndn::optional<time::milliseconds> dataFreshnessPeriod)
 {
-  time::nanoseconds stragglerTime = time::milliseconds(100);
-
-  scheduler::cancel(pitEntry->m_stragglerTimer);
-  pitEntry->m_stragglerTimer = scheduler::schedule(stragglerTime,
-    bind(&Forwarder::onInterestFinalize, this, pitEntry, isSatisfied, dataFreshnessPeriod));
+  pitEntry->m_isStraggler = true;
+  pitEntry->m_isSatisfied = isSatisfied;
+  pitEntry->m_dataFreshnessPeriod = dataFreshnessPeriod;
+  m_pitExpiryTimers.arm(*pitEntry, time::steady_clock::now() + m_stragglerTime);
 }
 
 void
 Forwarder::cancelUnsatisfyAndStragglerTimer(pit::Entry& pitEntry)
 {
-  scheduler::cancel(pitEntry.m_unsatisfyTimer);
-  scheduler::cancel(pitEntry.m_stragglerTimer);
+  m_pitExpiryTimers.cancel(pitEntry);
+}
+
+void
+Forwarder::onPitEntryExpired(pit::Entry& entry)
+{
+  shared_ptr<pit::Entry> pitEntry = entry.shared_from_this();
+  if (pitEntry->m_isStraggler) {
+    this->onInterestFinalize(pitEntry, pitEntry->m_isSatisfied, pitEntry->m_dataFreshnessPeriod);
+  }
+  else {
+    this->onInterestUnsatisfied(pitEntry);
+  }
 }
 
 static inline void
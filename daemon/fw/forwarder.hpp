@@ -30,6 +30,7 @@
 #include "core/scheduler.hpp"
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
+#include "probing-budget.hpp"
 #include "unsolicited-data-policy.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
@@ -103,6 +104,31 @@ public: // faces and policies
     m_unsolicitedDataPolicy = std::move(policy);
   }
 
+  /** \brief default duration of the straggler timer
+   */
+  static const time::nanoseconds DEFAULT_STRAGGLER_TIME;
+
+  /** \return how long a PIT entry is kept after it has been satisfied or rejected
+   */
+  time::nanoseconds
+  getStragglerTime() const
+  {
+    return m_stragglerTime;
+  }
+
+  /** \brief sets how long a PIT entry is kept after it has been satisfied or rejected
+   *
+   *  During this period, retransmitted or looping Interests still find the entry,
+   *  and strategies can collect measurements from late Data. Pit::getStatistics reports
+   *  how often stragglers are hit, to help choose this duration.
+   */
+  void
+  setStragglerTime(time::nanoseconds stragglerTime)
+  {
+    BOOST_ASSERT(stragglerTime >= time::nanoseconds::zero());
+    m_stragglerTime = stragglerTime;
+  }
+
 public: // forwarding entrypoints and tables
   /** \brief start incoming Interest processing
    *  \param face face on which Interest is received
@@ -114,6 +140,27 @@ public: // forwarding entrypoints and tables
     this->onIncomingInterest(face, interest);
   }
 
+  /** \brief sets the maximum number of Interests processed in one batch
+   *
+   *  When \p limit is greater than 1, Interests received on faces are queued, and processed
+   *  once the I/O completions already pending have delivered their packets, or as soon as
+   *  \p limit Interests are queued. A batch goes through the incoming Interest pipeline
+   *  stage by stage, so that each stage runs over many packets with warm caches.
+   *  When \p limit is 1 (the default), each Interest is processed as soon as it is received.
+   */
+  void
+  setInterestBatchLimit(size_t limit);
+
+  /** \brief default maximum number of Interests processed in one batch, which disables batching
+   */
+  static const size_t DEFAULT_INTEREST_BATCH_LIMIT;
+
+  size_t
+  getInterestBatchLimit() const
+  {
+    return m_interestBatchLimit;
+  }
+
   /** \brief start incoming Data processing
    *  \param face face on which Data is received
    *  \param data the incoming Data, must be well-formed and created with make_shared
@@ -182,6 +229,14 @@ public: // forwarding entrypoints and tables
     return m_networkRegionTable;
   }
 
+  /** \brief budget of probe Interests shared by all strategies of this forwarder
+   */
+  fw::ProbingBudget&
+  getProbingBudget()
+  {
+    return m_probingBudget;
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief incoming Interest pipeline
    */
@@ -255,6 +310,29 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onDroppedInterest(Face& outFace, const Interest& interest);
 
+PROTECTED_WITH_TESTS_ELSE_PRIVATE: // incoming Interest pipeline stages
+  /** \brief first stage of incoming Interest pipeline, before PIT insertion
+   *  \retval false the Interest has been dropped or passed to Interest loop pipeline
+   */
+  bool
+  acceptIncomingInterest(Face& inFace, const Interest& interest);
+
+  /** \brief last stage of incoming Interest pipeline, after PIT insertion
+   */
+  void
+  continueIncomingInterest(Face& inFace, const Interest& interest,
+                           const shared_ptr<pit::Entry>& pitEntry);
+
+  /** \brief queues an Interest for batch processing
+   */
+  void
+  enqueueInterest(Face& inFace, const Interest& interest);
+
+  /** \brief runs queued Interests through incoming Interest pipeline, stage by stage
+   */
+  void
+  processInterestBatch();
+
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   VIRTUAL_WITH_TESTS void
   setUnsatisfyTimer(const shared_ptr<pit::Entry>& pitEntry);
@@ -266,6 +344,14 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   VIRTUAL_WITH_TESTS void
   cancelUnsatisfyAndStragglerTimer(pit::Entry& pitEntry);
 
+  /** \brief invoked when the expiry timer of a PIT entry fires
+   *
+   *  This enters the Interest unsatisfied pipeline or the Interest finalize pipeline,
+   *  depending on whether the timer has been armed as the unsatisfy or the straggler timer.
+   */
+  void
+  onPitEntryExpired(pit::Entry& pitEntry);
+
   /** \brief insert Nonce to Dead Nonce List if necessary
    *  \param upstream if null, insert Nonces from all out-records;
    *                  if not null, insert Nonce only on the out-records of this face
@@ -297,11 +383,18 @@ private:
   NameTree           m_nameTree;
   Fib                m_fib;
   Pit                m_pit;
+  pit::TimerWheel    m_pitExpiryTimers;
   Cs                 m_cs;
   Measurements       m_measurements;
   StrategyChoice     m_strategyChoice;
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
+  fw::ProbingBudget  m_probingBudget;
+
+  time::nanoseconds m_stragglerTime;
+  size_t m_interestBatchLimit;
+  std::vector<std::pair<FaceId, shared_ptr<const Interest>>> m_interestBatch;
+  scheduler::ScopedEventId m_interestBatchEvent;
 
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hash-multipath-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/logger.hpp"
+#include "table/name-tree-hashtable.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(HashMultipathStrategy);
+
+NFD_LOG_INIT("HashMultipathStrategy");
+
+const time::milliseconds HashMultipathStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds HashMultipathStrategy::RETX_SUPPRESSION_MAX(250);
+
+HashMultipathStrategy::HashMultipathStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+  , m_nFlowComponents(0)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  switch (parsed.parameters.size()) {
+  case 1:
+    m_nFlowComponents = parseNFlowComponents(parsed.parameters.at(0).toUri());
+    break;
+  case 0:
+    break;
+  default:
+    BOOST_THROW_EXCEPTION(std::invalid_argument("HashMultipathStrategy does not accept more than 1 parameter"));
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "HashMultipathStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+HashMultipathStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/hash-multipath/%FD%01");
+  return strategyName;
+}
+
+size_t
+HashMultipathStrategy::parseNFlowComponents(const std::string& parameter)
+{
+  size_t nFlowComponents = 0;
+  // lexical_cast to an unsigned type would accept a negative number
+  if (!parameter.empty() && parameter.find_first_not_of("0123456789") == std::string::npos) {
+    try {
+      nFlowComponents = boost::lexical_cast<size_t>(parameter);
+    }
+    catch (const boost::bad_lexical_cast&) {
+    }
+  }
+  if (nFlowComponents == 0) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "Parameter to HashMultipathStrategy must be a positive decimal integer"));
+  }
+  return nFlowComponents;
+}
+
+void
+HashMultipathStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                            const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppressResult = m_retxSuppression.decidePerPitEntry(*pitEntry);
+  if (suppressResult == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " suppressed");
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  Face* outFace = this->chooseNextHop(fibEntry, inFace, interest);
+  if (outFace == nullptr) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, inFace, nackHeader);
+
+    this->rejectPendingInterest(pitEntry);
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " to=" << outFace->getId());
+  this->sendInterest(pitEntry, *outFace, interest);
+}
+
+void
+HashMultipathStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                        const shared_ptr<pit::Entry>& pitEntry)
+{
+  this->processNack(inFace, nack, pitEntry);
+}
+
+/** \brief mixes the bits of \p x (finalizer of SplitMix64)
+ */
+static uint64_t
+mixBits(uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+Face*
+HashMultipathStrategy::chooseNextHop(const fib::Entry& fibEntry, const Face& inFace,
+                                     const Interest& interest) const
+{
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+  const Name& name = interest.getName();
+
+  size_t flowLen = m_nFlowComponents == 0 ? (name.empty() ? 0 : name.size() - 1) :
+                                            std::min(m_nFlowComponents, name.size());
+  uint64_t flowHash = name_tree::computeHash(name, flowLen);
+
+  // nexthops are sorted by cost, so the lowest-cost eligible nexthops come first
+  Face* chosen = nullptr;
+  uint64_t chosenCost = 0;
+  uint64_t chosenScore = 0;
+  for (size_t i = 0; i < nexthops.size(); ++i) {
+    Face& outFace = nexthops[i].getFace();
+    if (!fibEntry.isNextHopUsable(i) ||
+        (outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) ||
+        wouldViolateScope(inFace, interest, outFace)) {
+      continue;
+    }
+
+    if (chosen != nullptr && nexthops[i].getCost() > chosenCost) {
+      break;
+    }
+
+    // rendezvous hashing: the nexthop with the highest score for the flow wins
+    uint64_t score = mixBits(flowHash ^ mixBits(outFace.getId()));
+    if (chosen == nullptr || score > chosenScore) {
+      chosen = &outFace;
+      chosenCost = nexthops[i].getCost();
+      chosenScore = score;
+    }
+  }
+  return chosen;
+}
+
+} // namespace fw
+} // namespace nfd
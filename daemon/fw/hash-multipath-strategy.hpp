@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_HASH_MULTIPATH_STRATEGY_HPP
+#define NFD_DAEMON_FW_HASH_MULTIPATH_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief a forwarding strategy that spreads flows across equal-cost nexthops by hashing
+ *
+ *  A flow is identified by a prefix of the Interest name. By default, the prefix is
+ *  the name without its last component, so that all segments of an object form one flow;
+ *  the strategy instance name may instead specify the number of prefix components as
+ *  decimal text, e.g. /localhost/nfd/strategy/hash-multipath/%FD%01/3
+ *
+ *  Each Interest is forwarded to one of the lowest-cost eligible nexthops, chosen by
+ *  rendezvous hashing of the flow hash with the FaceId of each nexthop. All Interests of
+ *  a flow therefore take the same path, different flows spread across the nexthops, and
+ *  adding or removing a nexthop only moves the flows that map to it. No per-flow state
+ *  is kept.
+ */
+class HashMultipathStrategy : public Strategy
+                            , public ProcessNackTraits<HashMultipathStrategy>
+{
+public:
+  explicit
+  HashMultipathStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \return number of leading name components that identify a flow,
+   *          or 0 if a flow is identified by the name without its last component
+   */
+  size_t
+  getNFlowComponents() const
+  {
+    return m_nFlowComponents;
+  }
+
+  /** \brief choose a nexthop for \p interest
+   *  \return the face of the chosen nexthop, or nullptr if no nexthop is eligible
+   */
+  Face*
+  chooseNextHop(const fib::Entry& fibEntry, const Face& inFace, const Interest& interest) const;
+
+private:
+  /** \brief parse the number of flow components from a decimal parameter
+   *  \throw std::invalid_argument \p parameter is not a positive decimal integer
+   */
+  static size_t
+  parseNFlowComponents(const std::string& parameter);
+
+private:
+  friend ProcessNackTraits<HashMultipathStrategy>;
+  RetxSuppressionExponential m_retxSuppression;
+  size_t m_nFlowComponents;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_HASH_MULTIPATH_STRATEGY_HPP
@@ -26,6 +26,7 @@
 #include "multicast-strategy.hpp"
 #include "algorithm.hpp"
 #include "core/logger.hpp"
+#include "face/shared-encoding.hpp"
 
 namespace nfd {
 namespace fw {
@@ -73,6 +74,8 @@ MulticastStrategy::afterReceiveInterest(const Face& inFace, const Interest& inte
 
   bool isSuppressed = false;
 
+  // GenericLinkService shares one encoding of the Interest among all nexthops
+  face::SharedEncodingScope sharedEncoding(interest);
   for (const auto& nexthop : nexthops) {
     Face& outFace = nexthop.getFace();
 
@@ -35,9 +35,11 @@ NFD_REGISTER_STRATEGY(NccStrategy);
 const time::microseconds NccStrategy::DEFER_FIRST_WITHOUT_BEST_FACE = time::microseconds(4000);
 const time::microseconds NccStrategy::DEFER_RANGE_WITHOUT_BEST_FACE = time::microseconds(75000);
 const time::nanoseconds NccStrategy::MEASUREMENTS_LIFETIME = time::seconds(16);
+uint64_t NccStrategy::s_lastDeadlineId = 0;
 
 NccStrategy::NccStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder)
+  , m_wakeupTime(time::steady_clock::TimePoint::max())
 {
   ParsedInstanceName parsed = parseInstanceName(name);
   if (!parsed.parameters.empty()) {
@@ -75,6 +77,7 @@ NccStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
   }
 
   MeasurementsEntryInfo& meInfo = this->getMeasurementsEntryInfo(pitEntry);
+  time::steady_clock::TimePoint now = time::steady_clock::now();
 
   time::microseconds deferFirst = DEFER_FIRST_WITHOUT_BEST_FACE;
   time::microseconds deferRange = DEFER_RANGE_WITHOUT_BEST_FACE;
@@ -89,9 +92,7 @@ NccStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
     deferRange = time::microseconds((deferFirst.count() + 1) / 2);
     --nUpstreams;
     this->sendInterest(pitEntry, *bestFace, interest);
-    pitEntryInfo->bestFaceTimeout = scheduler::schedule(
-      meInfo.prediction,
-      bind(&NccStrategy::timeoutOnBestFace, this, weak_ptr<pit::Entry>(pitEntry)));
+    pitEntryInfo->bestFaceDeadline = now + meInfo.prediction;
   }
   else {
     // use first eligible nexthop
@@ -127,21 +128,18 @@ NccStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
     // this maxInterval would be used to determine when the next doPropagate would happen.
     pitEntryInfo->maxInterval = deferFirst;
   }
-  pitEntryInfo->propagateTimer = scheduler::schedule(deferFirst,
-    bind(&NccStrategy::doPropagate, this, inFace.getId(), weak_ptr<pit::Entry>(pitEntry)));
+  pitEntryInfo->propagateInFaceId = inFace.getId();
+  pitEntryInfo->propagateDeadline = now + deferFirst;
+  this->armDeadline(pitEntry, *pitEntryInfo);
 }
 
 void
-NccStrategy::doPropagate(FaceId inFaceId, weak_ptr<pit::Entry> pitEntryWeak)
+NccStrategy::doPropagate(FaceId inFaceId, const shared_ptr<pit::Entry>& pitEntry)
 {
   Face* inFace = this->getFace(inFaceId);
   if (inFace == nullptr) {
     return;
   }
-  shared_ptr<pit::Entry> pitEntry = pitEntryWeak.lock();
-  if (pitEntry == nullptr) {
-    return;
-  }
   pit::InRecordCollection::const_iterator inRecord = pitEntry->getInRecord(*inFace);
   if (inRecord == pitEntry->in_end()) {
     return;
@@ -151,7 +149,7 @@ NccStrategy::doPropagate(FaceId inFaceId, weak_ptr<pit::Entry> pitEntryWeak)
 
   PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
   // pitEntryInfo is guaranteed to exist here, because doPropagate is triggered
-  // from a timer set by NccStrategy.
+  // from a deadline set by NccStrategy.
   BOOST_ASSERT(pitEntryInfo != nullptr);
 
   MeasurementsEntryInfo& meInfo = this->getMeasurementsEntryInfo(pitEntry);
@@ -178,18 +176,13 @@ NccStrategy::doPropagate(FaceId inFaceId, weak_ptr<pit::Entry> pitEntryWeak)
   if (isForwarded) {
     std::uniform_int_distribution<time::nanoseconds::rep> dist(0, pitEntryInfo->maxInterval.count() - 1);
     time::nanoseconds deferNext = time::nanoseconds(dist(getGlobalRng()));
-    pitEntryInfo->propagateTimer = scheduler::schedule(deferNext,
-      bind(&NccStrategy::doPropagate, this, inFaceId, weak_ptr<pit::Entry>(pitEntry)));
+    pitEntryInfo->propagateDeadline = time::steady_clock::now() + deferNext;
   }
 }
 
 void
-NccStrategy::timeoutOnBestFace(weak_ptr<pit::Entry> pitEntryWeak)
+NccStrategy::timeoutOnBestFace(const shared_ptr<pit::Entry>& pitEntry)
 {
-  shared_ptr<pit::Entry> pitEntry = pitEntryWeak.lock();
-  if (pitEntry == nullptr) {
-    return;
-  }
   measurements::Entry* measurementsEntry = this->getMeasurements().get(*pitEntry);
 
   for (int i = 0; i < UPDATE_MEASUREMENTS_N_LEVELS; ++i) {
@@ -233,15 +226,94 @@ NccStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
 
   PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
   if (pitEntryInfo != nullptr) {
-    scheduler::cancel(pitEntryInfo->propagateTimer);
+    pitEntryInfo->propagateDeadline = time::steady_clock::TimePoint::max();
 
     // Verify that the best face satisfied the interest before canceling the timeout call
     MeasurementsEntryInfo& meInfo = this->getMeasurementsEntryInfo(pitEntry);
     shared_ptr<Face> bestFace = meInfo.getBestFace();
 
     if (bestFace.get() == &inFace)
-      scheduler::cancel(pitEntryInfo->bestFaceTimeout);
+      pitEntryInfo->bestFaceDeadline = time::steady_clock::TimePoint::max();
+  }
+}
+
+void
+NccStrategy::armDeadline(const shared_ptr<pit::Entry>& pitEntry, PitEntryInfo& info)
+{
+  time::steady_clock::TimePoint deadline = info.getNextDeadline();
+  if (deadline == time::steady_clock::TimePoint::max()) {
+    // nothing pending; a queued item, if any, is skipped when it fires
+    return;
+  }
+  if (info.deadlineId != 0 && info.queuedDeadline <= deadline) {
+    // the queued item fires early enough, and the entry will be re-queued then
+    return;
+  }
+
+  info.deadlineId = ++s_lastDeadlineId;
+  info.queuedDeadline = deadline;
+  m_deadlines.push({deadline, pitEntry->getHandle(), info.deadlineId});
+
+  // the scheduler is touched only if this entry is due before all queued ones
+  if (deadline < m_wakeupTime) {
+    this->scheduleWakeup();
+  }
+}
+
+void
+NccStrategy::processDeadlines()
+{
+  m_wakeupTime = time::steady_clock::TimePoint::max();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  // collect the whole batch first, so that a deadline set while servicing it
+  // is not serviced until the next wakeup, as if it were a separate event
+  std::vector<shared_ptr<pit::Entry>> dueEntries;
+  while (!m_deadlines.empty() && m_deadlines.top().deadline <= now) {
+    const QueuedDeadline& item = m_deadlines.top();
+    pit::Entry* pitEntry = this->getPitEntry(item.pitEntry);
+    if (pitEntry != nullptr) {
+      PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+      if (pitEntryInfo != nullptr && pitEntryInfo->deadlineId == item.deadlineId) {
+        pitEntryInfo->deadlineId = 0;
+        dueEntries.push_back(pitEntry->shared_from_this());
+      }
+    }
+    m_deadlines.pop();
   }
+
+  for (const shared_ptr<pit::Entry>& pitEntry : dueEntries) {
+    PitEntryInfo* pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+    if (pitEntryInfo != nullptr && pitEntryInfo->bestFaceDeadline <= now) {
+      pitEntryInfo->bestFaceDeadline = time::steady_clock::TimePoint::max();
+      this->timeoutOnBestFace(pitEntry);
+    }
+
+    pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+    if (pitEntryInfo != nullptr && pitEntryInfo->propagateDeadline <= now) {
+      pitEntryInfo->propagateDeadline = time::steady_clock::TimePoint::max();
+      this->doPropagate(pitEntryInfo->propagateInFaceId, pitEntry);
+    }
+
+    pitEntryInfo = pitEntry->getStrategyInfo<PitEntryInfo>();
+    if (pitEntryInfo != nullptr) {
+      this->armDeadline(pitEntry, *pitEntryInfo);
+    }
+  }
+
+  if (!m_deadlines.empty() && m_deadlines.top().deadline < m_wakeupTime) {
+    this->scheduleWakeup();
+  }
+}
+
+void
+NccStrategy::scheduleWakeup()
+{
+  BOOST_ASSERT(!m_deadlines.empty());
+  m_wakeupTime = m_deadlines.top().deadline;
+  m_wakeupEvent = scheduler::schedule(std::max(time::steady_clock::Duration::zero(),
+                                               m_wakeupTime - time::steady_clock::now()),
+                                      bind(&NccStrategy::processDeadlines, this));
 }
 
 NccStrategy::MeasurementsEntryInfo&
@@ -335,10 +407,13 @@ NccStrategy::MeasurementsEntryInfo::ageBestFace()
   this->bestFace.reset();
 }
 
-NccStrategy::PitEntryInfo::~PitEntryInfo()
+NccStrategy::PitEntryInfo::PitEntryInfo()
+  : bestFaceDeadline(time::steady_clock::TimePoint::max())
+  , propagateDeadline(time::steady_clock::TimePoint::max())
+  , propagateInFaceId(face::INVALID_FACEID)
+  , maxInterval(0)
+  , deadlineId(0)
 {
-  scheduler::cancel(this->bestFaceTimeout);
-  scheduler::cancel(this->propagateTimer);
 }
 
 } // namespace fw
@@ -28,6 +28,8 @@
 
 #include "strategy.hpp"
 
+#include <queue>
+
 namespace nfd {
 namespace fw {
 
@@ -104,16 +106,29 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
       return 1001;
     }
 
-    virtual
-    ~PitEntryInfo() override;
+    PitEntryInfo();
+
+    /** \return the earlier of bestFaceDeadline and propagateDeadline
+     */
+    time::steady_clock::TimePoint
+    getNextDeadline() const
+    {
+      return std::min(bestFaceDeadline, propagateDeadline);
+    }
 
   public:
-    /// timer that expires when best face does not respond within predicted time
-    scheduler::EventId bestFaceTimeout;
-    /// timer for propagating to another face
-    scheduler::EventId propagateTimer;
+    /// when best face does not respond within predicted time; TimePoint::max() if not pending
+    time::steady_clock::TimePoint bestFaceDeadline;
+    /// when to propagate to another face; TimePoint::max() if not pending
+    time::steady_clock::TimePoint propagateDeadline;
+    /// incoming face of the Interest to be propagated
+    FaceId propagateInFaceId;
     /// maximum interval between forwarding to two nexthops except best and previous
     time::microseconds maxInterval;
+    /// id of the deadline queue item that services this entry; 0 if none
+    uint64_t deadlineId;
+    /// deadline of the queued item; meaningful only if deadlineId is not 0
+    time::steady_clock::TimePoint queuedDeadline;
   };
 
 protected:
@@ -125,11 +140,61 @@ protected:
 
   /// propagate to another upstream
   void
-  doPropagate(FaceId inFaceId, weak_ptr<pit::Entry> pitEntryWeak);
+  doPropagate(FaceId inFaceId, const shared_ptr<pit::Entry>& pitEntry);
 
   /// best face did not reply within prediction
   void
-  timeoutOnBestFace(weak_ptr<pit::Entry> pitEntryWeak);
+  timeoutOnBestFace(const shared_ptr<pit::Entry>& pitEntry);
+
+private:
+  /** \brief make sure \p pitEntry is queued no later than its next deadline
+   *
+   *  A queued item that fires earlier than needed is left in place; the entry is re-queued
+   *  when that item is serviced.
+   */
+  void
+  armDeadline(const shared_ptr<pit::Entry>& pitEntry, PitEntryInfo& info);
+
+  /** \brief service all PIT entries whose queued deadline has been reached
+   */
+  void
+  processDeadlines();
+
+  /** \brief arm the wakeup event for the earliest queued deadline
+   */
+  void
+  scheduleWakeup();
+
+  struct QueuedDeadline
+  {
+    time::steady_clock::TimePoint deadline;
+    pit::EntryHandle pitEntry;
+    uint64_t deadlineId;
+  };
+
+  struct QueuedDeadlineIsLater
+  {
+    bool
+    operator()(const QueuedDeadline& a, const QueuedDeadline& b) const
+    {
+      return a.deadline > b.deadline;
+    }
+  };
+
+  /** \brief deadline slots of all PIT entries, earliest deadline on top
+   *
+   *  A single scheduler event is armed for the earliest deadline, and all entries due by then
+   *  are serviced in one batch. An item whose PIT entry has been erased, or whose deadlineId
+   *  no longer matches the PitEntryInfo (because the entry was satisfied or re-queued earlier),
+   *  is skipped.
+   */
+  std::priority_queue<QueuedDeadline, std::vector<QueuedDeadline>, QueuedDeadlineIsLater> m_deadlines;
+  scheduler::ScopedEventId m_wakeupEvent;
+  time::steady_clock::TimePoint m_wakeupTime;
+
+  /** \brief last assigned deadline id, shared by all instances so that an id is never reused
+   */
+  static uint64_t s_lastDeadlineId;
 
 protected:
   static const time::microseconds DEFER_FIRST_WITHOUT_BEST_FACE;
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "probing-budget.hpp"
+
+namespace nfd {
+namespace fw {
+
+constexpr double ProbingBudget::DEFAULT_PROBES_PER_SECOND;
+
+ProbingBudget::ProbingBudget(double probesPerSecond)
+  : m_lastUpdate(time::steady_clock::now())
+{
+  this->setProbesPerSecond(probesPerSecond);
+}
+
+void
+ProbingBudget::setProbesPerSecond(double probesPerSecond)
+{
+  BOOST_ASSERT(probesPerSecond > 0);
+  m_probesPerSecond = probesPerSecond;
+  m_nAvailableProbes = std::max(1.0, probesPerSecond);
+}
+
+bool
+ProbingBudget::consume()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  double elapsed = time::duration_cast<time::duration<double>>(now - m_lastUpdate).count();
+  m_nAvailableProbes = std::min(m_nAvailableProbes + elapsed * m_probesPerSecond,
+                                std::max(1.0, m_probesPerSecond));
+  m_lastUpdate = now;
+
+  if (m_nAvailableProbes < 1.0) {
+    return false;
+  }
+  m_nAvailableProbes -= 1.0;
+  return true;
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_PROBING_BUDGET_HPP
+#define NFD_DAEMON_FW_PROBING_BUDGET_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief a token bucket that limits probe Interests sent by strategies of one forwarder
+ *
+ *  Strategies that probe alternate nexthops (e.g. ASF) take a probe from the budget of their
+ *  Forwarder, so that probe traffic of a forwarder stays bounded regardless of the number of
+ *  namespaces and strategy instances.
+ */
+class ProbingBudget : noncopyable
+{
+public:
+  explicit
+  ProbingBudget(double probesPerSecond = DEFAULT_PROBES_PER_SECOND);
+
+  /** \return the maximum number of probes per second
+   */
+  double
+  getProbesPerSecond() const
+  {
+    return m_probesPerSecond;
+  }
+
+  /** \brief set the maximum number of probes per second
+   *  \pre probesPerSecond > 0
+   *
+   *  The budget is refilled to one second worth of probes.
+   */
+  void
+  setProbesPerSecond(double probesPerSecond);
+
+  /** \brief take one probe from the budget
+   *  \return whether a probe was available
+   *
+   *  The budget is refilled from the time elapsed since the previous call,
+   *  and can accumulate up to one second worth of probes.
+   */
+  bool
+  consume();
+
+public:
+  static constexpr double DEFAULT_PROBES_PER_SECOND = 1000.0;
+
+private:
+  double m_probesPerSecond;
+  double m_nAvailableProbes;
+  time::steady_clock::TimePoint m_lastUpdate;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_PROBING_BUDGET_HPP
@@ -262,6 +262,18 @@ protected: // accessors
     return m_forwarder.getFaceTable();
   }
 
+  /** \brief resolves a PIT entry handle
+   *  \return the PIT entry, or nullptr if it has been erased from the PIT
+   *
+   *  A strategy that needs to refer to a PIT entry later, e.g. from a timer, can keep
+   *  pit::Entry::getHandle() instead of a weak_ptr, which avoids reference counting.
+   */
+  pit::Entry*
+  getPitEntry(const pit::EntryHandle& handle) const
+  {
+    return m_forwarder.getPit().get(handle);
+  }
+
 protected: // instance name
   struct ParsedInstanceName
   {
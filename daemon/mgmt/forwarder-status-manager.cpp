@@ -25,6 +25,7 @@
 
 #include "forwarder-status-manager.hpp"
 #include "fw/forwarder.hpp"
+#include "face/generic-link-service.hpp"
 #include "core/version.hpp"
 
 namespace nfd {
@@ -38,6 +39,13 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
                                 bind(&ForwarderStatusManager::listGeneralStatus, this, _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/pit", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listPitStatistics, this, _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/measurements", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listMeasurementsStatistics, this,
+                                     _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/congestion", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listFaceCongestion, this, _1, _2, _3));
 }
 
 ndn::nfd::ForwarderStatus
@@ -81,4 +89,104 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   context.end();
 }
 
+static void
+appendPitRecord(Block& block, const pit::Statistics::Record& record)
+{
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NPitInterests, record.nInterests));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NPitAggregated, record.nAggregated));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NPitStragglerHits,
+                                                             record.nStragglerHits));
+}
+
+static Block
+encodeResidencyHistogram(uint32_t type, const pit::Statistics::ResidencyHistogram& histogram)
+{
+  Block block(type);
+  for (uint64_t count : histogram) {
+    block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::PitResidencyBucket, count));
+  }
+  block.encode();
+  return block;
+}
+
+void
+ForwarderStatusManager::listPitStatistics(const Name& topPrefix, const Interest& interest,
+                                          ndn::mgmt::StatusDatasetContext& context)
+{
+  context.setExpiry(STATUS_FRESHNESS);
+
+  const pit::Statistics& statistics = m_forwarder.getPit().getStatistics();
+
+  Block total(tlv::PitStatistics);
+  appendPitRecord(total, statistics.getTotal());
+  total.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NPitStragglerExpirations,
+                                                             statistics.getNStragglerExpirations()));
+  total.push_back(encodeResidencyHistogram(tlv::PitSatisfiedResidency,
+                                           statistics.getSatisfiedResidency()));
+  total.push_back(encodeResidencyHistogram(tlv::PitUnsatisfiedResidency,
+                                           statistics.getUnsatisfiedResidency()));
+  total.encode();
+  context.append(total);
+
+  for (const auto& prefixAndRecord : statistics.getPrefixRecords()) {
+    Block record(tlv::PitPrefixStatistics);
+    record.push_back(prefixAndRecord.first.wireEncode());
+    appendPitRecord(record, prefixAndRecord.second);
+    record.encode();
+    context.append(record);
+  }
+  context.end();
+}
+
+void
+ForwarderStatusManager::listMeasurementsStatistics(const Name& topPrefix, const Interest& interest,
+                                                   ndn::mgmt::StatusDatasetContext& context)
+{
+  context.setExpiry(STATUS_FRESHNESS);
+
+  const Measurements& measurements = m_forwarder.getMeasurements();
+
+  Block block(tlv::MeasurementsStatistics);
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NMeasurementsEntries,
+                                                             measurements.size()));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::MeasurementsLimit,
+                                                             measurements.getLimit()));
+  block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NMeasurementsEvictions,
+                                                             measurements.getNEvictions()));
+  block.encode();
+  context.append(block);
+  context.end();
+}
+
+void
+ForwarderStatusManager::listFaceCongestion(const Name& topPrefix, const Interest& interest,
+                                           ndn::mgmt::StatusDatasetContext& context)
+{
+  using ndn::encoding::makeNonNegativeIntegerBlock;
+
+  context.setExpiry(STATUS_FRESHNESS);
+
+  for (const Face& face : m_forwarder.getFaceTable()) {
+    const face::Transport::Counters& transportCounters = face.getTransport()->getCounters();
+
+    Block block(tlv::FaceCongestionStatistics);
+    block.push_back(makeNonNegativeIntegerBlock(ndn::tlv::nfd::FaceId, face.getId()));
+    block.push_back(makeNonNegativeIntegerBlock(tlv::NOutPackets, transportCounters.nOutPackets));
+    block.push_back(makeNonNegativeIntegerBlock(tlv::SendQueueSojournTime,
+                                                transportCounters.sendQueueSojournTime));
+
+    auto linkServiceCounters = dynamic_cast<const face::GenericLinkService::Counters*>(
+                                 &face.getLinkService()->getCounters());
+    if (linkServiceCounters != nullptr) {
+      block.push_back(makeNonNegativeIntegerBlock(tlv::NCongestionMarked,
+                                                  linkServiceCounters->nCongestionMarked));
+      block.push_back(makeNonNegativeIntegerBlock(tlv::NCongestionDropped,
+                                                  linkServiceCounters->nCongestionDropped));
+    }
+    block.encode();
+    context.append(block);
+  }
+  context.end();
+}
+
 } // namespace nfd
@@ -33,6 +33,75 @@ namespace nfd {
 
 class Forwarder;
 
+namespace tlv {
+
+/** \brief TLV-TYPE numbers of the PIT statistics dataset
+ *
+ *  The dataset consists of one PitStatistics block followed by zero or more
+ *  PitPrefixStatistics blocks:
+ *  \code{.unparsed}
+ *  PitStatistics := PIT-STATISTICS-TYPE TLV-LENGTH
+ *                     NPitInterests NPitAggregated NPitStragglerHits NPitStragglerExpirations
+ *                     PitSatisfiedResidency PitUnsatisfiedResidency
+ *  PitPrefixStatistics := PIT-PREFIX-STATISTICS-TYPE TLV-LENGTH
+ *                           Name NPitInterests NPitAggregated NPitStragglerHits
+ *  PitSatisfiedResidency, PitUnsatisfiedResidency := TLV-TYPE TLV-LENGTH
+ *                                                     PitResidencyBucket*
+ *  \endcode
+ *  Each histogram has pit::Statistics::N_RESIDENCY_BUCKETS buckets.
+ *  These numbers are only meaningful within this dataset.
+ */
+enum {
+  PitStatistics            = 200,
+  PitPrefixStatistics      = 201,
+  NPitInterests            = 202,
+  NPitAggregated           = 203,
+  NPitStragglerHits        = 204,
+  NPitStragglerExpirations = 205,
+  PitSatisfiedResidency    = 206,
+  PitUnsatisfiedResidency  = 207,
+  PitResidencyBucket       = 208
+};
+
+/** \brief TLV-TYPE numbers of the Measurements statistics dataset
+ *
+ *  The dataset consists of one MeasurementsStatistics block:
+ *  \code{.unparsed}
+ *  MeasurementsStatistics := MEASUREMENTS-STATISTICS-TYPE TLV-LENGTH
+ *                              NMeasurementsEntries MeasurementsLimit NMeasurementsEvictions
+ *  \endcode
+ *  These numbers are only meaningful within this dataset.
+ */
+enum {
+  MeasurementsStatistics = 209,
+  NMeasurementsEntries   = 210,
+  MeasurementsLimit      = 211,
+  NMeasurementsEvictions = 212
+};
+
+/** \brief TLV-TYPE numbers of the face congestion dataset
+ *
+ *  The dataset consists of one FaceCongestionStatistics block per face:
+ *  \code{.unparsed}
+ *  FaceCongestionStatistics := FACE-CONGESTION-STATISTICS-TYPE TLV-LENGTH
+ *                                FaceId NOutPackets SendQueueSojournTime
+ *                                NCongestionMarked? NCongestionDropped?
+ *  \endcode
+ *  FaceId has the same TLV-TYPE as in FaceStatus. SendQueueSojournTime is in nanoseconds;
+ *  divided by NOutPackets, it gives the mean sojourn time. NCongestionMarked and
+ *  NCongestionDropped are present only if the face uses GenericLinkService.
+ *  These numbers are only meaningful within this dataset.
+ */
+enum {
+  FaceCongestionStatistics = 213,
+  NOutPackets              = 214,
+  SendQueueSojournTime     = 215,
+  NCongestionMarked        = 216,
+  NCongestionDropped       = 217
+};
+
+} // namespace tlv
+
 /**
  * @brief implement the Forwarder Status of NFD Management Protocol.
  * @sa http://redmine.named-data.net/projects/nfd/wiki/ForwarderStatus
@@ -52,6 +121,24 @@ private:
   listGeneralStatus(const Name& topPrefix, const Interest& interest,
                     ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief provide PIT aggregation and residency statistics dataset
+   */
+  void
+  listPitStatistics(const Name& topPrefix, const Interest& interest,
+                    ndn::mgmt::StatusDatasetContext& context);
+
+  /** \brief provide Measurements table size and eviction dataset
+   */
+  void
+  listMeasurementsStatistics(const Name& topPrefix, const Interest& interest,
+                             ndn::mgmt::StatusDatasetContext& context);
+
+  /** \brief provide send queue sojourn time and congestion signal dataset of each face
+   */
+  void
+  listFaceCongestion(const Name& topPrefix, const Interest& interest,
+                     ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder&  m_forwarder;
   Dispatcher& m_dispatcher;
@@ -29,6 +29,8 @@
 namespace nfd {
 
 const size_t TablesConfigSection::DEFAULT_CS_MAX_PACKETS = 65536;
+const size_t TablesConfigSection::DEFAULT_MEASUREMENTS_MAX_ENTRIES = 65536;
+const size_t TablesConfigSection::DEFAULT_PIT_STATISTICS_PREFIX_LENGTH = 0;
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
@@ -51,6 +53,11 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_forwarder.getMeasurements().setLimit(DEFAULT_MEASUREMENTS_MAX_ENTRIES);
+  m_forwarder.setStragglerTime(Forwarder::DEFAULT_STRAGGLER_TIME);
+  m_forwarder.getPit().getStatistics().setPrefixLength(DEFAULT_PIT_STATISTICS_PREFIX_LENGTH);
+  m_forwarder.setInterestBatchLimit(Forwarder::DEFAULT_INTEREST_BATCH_LIMIT);
+  m_forwarder.getProbingBudget().setProbesPerSecond(fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND);
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
@@ -91,6 +98,54 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  size_t nMeasurementsMaxEntries = DEFAULT_MEASUREMENTS_MAX_ENTRIES;
+  OptionalConfigSection measurementsMaxEntriesNode = section.get_child_optional("measurements_max_entries");
+  if (measurementsMaxEntriesNode) {
+    nMeasurementsMaxEntries = ConfigFile::parseNumber<size_t>(*measurementsMaxEntriesNode,
+                                                              "measurements_max_entries", "tables");
+    if (nMeasurementsMaxEntries == 0) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value for option \"measurements_max_entries\" in \"tables\" section"));
+    }
+  }
+
+  time::nanoseconds stragglerTime = Forwarder::DEFAULT_STRAGGLER_TIME;
+  OptionalConfigSection stragglerTimeNode = section.get_child_optional("pit_straggler_time");
+  if (stragglerTimeNode) {
+    stragglerTime = time::milliseconds(ConfigFile::parseNumber<uint32_t>(*stragglerTimeNode,
+                                                                         "pit_straggler_time", "tables"));
+  }
+
+  size_t pitStatisticsPrefixLength = DEFAULT_PIT_STATISTICS_PREFIX_LENGTH;
+  OptionalConfigSection pitStatisticsPrefixLengthNode =
+    section.get_child_optional("pit_statistics_prefix_length");
+  if (pitStatisticsPrefixLengthNode) {
+    pitStatisticsPrefixLength = ConfigFile::parseNumber<size_t>(*pitStatisticsPrefixLengthNode,
+                                                                "pit_statistics_prefix_length", "tables");
+  }
+
+  size_t interestBatchLimit = Forwarder::DEFAULT_INTEREST_BATCH_LIMIT;
+  OptionalConfigSection interestBatchLimitNode = section.get_child_optional("interest_batch_limit");
+  if (interestBatchLimitNode) {
+    interestBatchLimit = ConfigFile::parseNumber<size_t>(*interestBatchLimitNode,
+                                                         "interest_batch_limit", "tables");
+    if (interestBatchLimit == 0) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value for option \"interest_batch_limit\" in \"tables\" section"));
+    }
+  }
+
+  double probingBudget = fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND;
+  OptionalConfigSection probingBudgetNode = section.get_child_optional("probing_budget");
+  if (probingBudgetNode) {
+    probingBudget = ConfigFile::parseNumber<uint32_t>(*probingBudgetNode,
+                                                      "probing_budget", "tables");
+    if (probingBudget == 0) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value for option \"probing_budget\" in \"tables\" section"));
+    }
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -113,6 +168,13 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  m_forwarder.getMeasurements().setLimit(nMeasurementsMaxEntries);
+
+  m_forwarder.setStragglerTime(stragglerTime);
+  m_forwarder.getPit().getStatistics().setPrefixLength(pitStatisticsPrefixLength);
+  m_forwarder.setInterestBatchLimit(interestBatchLimit);
+  m_forwarder.getProbingBudget().setProbesPerSecond(probingBudget);
+
   m_isConfigured = true;
 }
 
@@ -40,6 +40,10 @@ namespace nfd {
  *    cs_max_packets 65536
  *    cs_policy priority_fifo
  *    cs_unsolicited_policy drop-all
+ *    measurements_max_entries 65536
+ *    pit_straggler_time 100
+ *    pit_statistics_prefix_length 0
+ *    interest_batch_limit 1
  *
  *    strategy_choice
  *    {
@@ -58,7 +62,8 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_policy, cs_unsolicited_policy, measurements_max_entries,
+ *      pit_straggler_time, pit_statistics_prefix_length, and interest_batch_limit are applied;
  *      defaults are used if an option is omitted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
@@ -93,6 +98,8 @@ private:
 
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
+  static const size_t DEFAULT_MEASUREMENTS_MAX_ENTRIES;
+  static const size_t DEFAULT_PIT_STATISTICS_PREFIX_LENGTH;
 
   Forwarder& m_forwarder;
 
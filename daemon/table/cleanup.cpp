@@ -30,27 +30,37 @@ namespace nfd {
 void
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face)
 {
-  std::multimap<size_t, const name_tree::Entry*> maybeEmptyNtes;
+  // name tree entries that may become empty, ordered by name length
+  std::set<std::pair<size_t, name_tree::Entry*>> maybeEmptyNtes;
 
-  // visit FIB and PIT entries in one pass of NameTree enumeration
-  for (const name_tree::Entry& nte : nt) {
-    fib::Entry* fibEntry = nte.getFibEntry();
-    if (fibEntry != nullptr) {
-      fib.removeNextHop(*fibEntry, face);
-    }
+  // visit only FIB and PIT entries that refer to the face, as found in their face indexes
+  for (fib::Entry* fibEntry : fib.findEntriesByFace(face)) {
+    name_tree::Entry* nte = nt.getEntry(*fibEntry);
+    BOOST_ASSERT(nte != nullptr);
 
-    for (const auto& pitEntry : nte.getPitEntries()) {
-      pit.deleteInOutRecords(pitEntry.get(), face);
+    fib.removeNextHop(*fibEntry, face);
+    if (!nte->hasTableEntries()) {
+      maybeEmptyNtes.emplace(nte->getName().size(), nte);
     }
+  }
 
-    if (!nte.hasTableEntries()) {
-      maybeEmptyNtes.emplace(nte.getName().size(), &nte);
-    }
+  for (pit::Entry* pitEntry : pit.findEntriesByFace(face)) {
+    pit.deleteInOutRecords(pitEntry, face);
   }
+  // also when the face has no records left, as they may have been deleted by other means
+  pit.eraseFace(face);
 
-  // try to erase longer names first, so that children are erased before parent is checked
-  for (auto i = maybeEmptyNtes.rbegin(); i != maybeEmptyNtes.rend(); ++i) {
-    nt.eraseIfEmpty(const_cast<name_tree::Entry*>(i->second), false);
+  // erase longer names first, so that children are erased before parent is checked;
+  // a parent without table entries becomes a candidate after its child is erased
+  while (!maybeEmptyNtes.empty()) {
+    auto last = std::prev(maybeEmptyNtes.end());
+    name_tree::Entry* nte = last->second;
+    maybeEmptyNtes.erase(last);
+
+    name_tree::Entry* parent = nte->getParent();
+    if (nt.eraseIfEmpty(nte, false) > 0 && parent != nullptr && !parent->hasTableEntries()) {
+      maybeEmptyNtes.emplace(parent->getName().size(), parent);
+    }
   }
 
   BOOST_ASSERT(nt.size() == 0 ||
@@ -34,15 +34,14 @@ namespace nfd {
 
 /** \brief cleanup tables when a face is destroyed
  *
- *  This function enumerates the NameTree, calls Fib::removeNextHop for each FIB entry,
- *  calls Pit::deleteInOutRecords for each PIT entry, and finally
- *  deletes any name tree entries that have become empty.
+ *  This function finds FIB and PIT entries referring to the face through the per-face indexes
+ *  of Fib and Pit, calls Fib::removeNextHop for each such FIB entry,
+ *  calls Pit::deleteInOutRecords for each such PIT entry, then Pit::eraseFace,
+ *  and finally deletes any name tree entries that have become empty.
+ *  Its cost is proportional to the number of affected entries, not the size of the NameTree.
  *
  *  \note It's a design choice to let Fib and Pit classes decide what to do with each entry.
  *        This function is only responsible for implementing the enumeration procedure.
- *        The benefit of having this function instead of doing the enumeration in Fib and Pit
- *        classes is to perform both FIB and PIT cleanups in one pass of NameTree enumeration,
- *        so as to reduce performance overhead.
  */
 void
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face);
@@ -41,11 +41,20 @@ const size_t DeadNonceList::EXPECTED_MARK_COUNT = 5;
 const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = (1 << 6);
+const size_t DeadNonceList::BLOOM_BITS_PER_ENTRY = 16;
+const size_t DeadNonceList::BLOOM_K = 4;
+const uint32_t DeadNonceList::EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+/// number of 64-bit words in a Bloom filter block, which is one cache line
+static const size_t BLOOM_BLOCK_WORDS = 8;
 
 DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
   : m_lifetime(lifetime)
-  , m_queue(m_index.get<0>())
-  , m_ht(m_index.get<1>())
+  , m_head(0)
+  , m_nEntries(0)
+  , m_nMarks(0)
+  , m_currentFilter(0)
+  , m_nCurrentFilterEntries(0)
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
   , m_adjustCapacityInterval(m_lifetime)
@@ -54,10 +63,14 @@ DeadNonceList::DeadNonceList(const time::nanoseconds& lifetime)
     BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
+  this->resizeRing(this->computeRingSize());
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
+    this->pushEntry(MARK);
   }
 
+  m_filters[0].reset(m_capacity);
+  m_filters[1].reset(m_capacity);
+
   m_markEvent = scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
   m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval,
                                               bind(&DeadNonceList::adjustCapacity, this));
@@ -78,26 +91,32 @@ DeadNonceList::~DeadNonceList()
   BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must adjust up");
   BOOST_ASSERT_MSG(CAPACITY_DOWN < 1.0, "CAPACITY_DOWN must adjust down");
   static_assert(EVICT_LIMIT >= 1, "EVICT_LIMIT must be at least 1");
+  BOOST_ASSERT_MSG(BLOOM_K * 9 <= 64 - 28, "BLOOM_K is too large for the Entry hash");
 }
 
 size_t
 DeadNonceList::size() const
 {
-  return m_queue.size() - this->countMarks();
+  return this->getQueueSize() - this->countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  return m_ht.find(entry) != m_ht.end();
+  if (!m_filters[m_currentFilter].mayContain(entry) &&
+      !m_filters[1 - m_currentFilter].mayContain(entry)) {
+    return false;
+  }
+  return this->findInIndex(entry);
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  m_queue.push_back(entry);
+  this->pushEntry(entry);
+  this->addToFilters(entry);
 
   this->evictEntries();
 }
@@ -110,22 +129,79 @@ DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
                             static_cast<uint64_t>(nonce));
 }
 
+void
+DeadNonceList::BloomFilter::reset(size_t nExpected)
+{
+  size_t nBlocks = 1;
+  while (nBlocks * BLOOM_BLOCK_WORDS * 64 < nExpected * BLOOM_BITS_PER_ENTRY) {
+    nBlocks <<= 1;
+  }
+  m_blockMask = nBlocks - 1;
+
+  // over-allocate by one cache line, so that blocks can be aligned to cache line boundaries
+  m_storage.assign((nBlocks + 1) * BLOOM_BLOCK_WORDS, 0);
+  uintptr_t base = reinterpret_cast<uintptr_t>(m_storage.data());
+  uintptr_t aligned = (base + BLOOM_BLOCK_WORDS * 8 - 1) & ~uintptr_t(BLOOM_BLOCK_WORDS * 8 - 1);
+  m_blocks = reinterpret_cast<uint64_t*>(aligned);
+}
+
+// Entry is already a uniformly distributed hash, so it is sliced instead of being rehashed:
+// the lower 28 bits select a block, and BLOOM_K 9-bit fields above them select bits in the block.
+
+void
+DeadNonceList::BloomFilter::add(Entry entry)
+{
+  uint64_t* block = m_blocks + (entry & m_blockMask) * BLOOM_BLOCK_WORDS;
+  for (size_t i = 0; i < BLOOM_K; ++i) {
+    unsigned bit = (entry >> (28 + 9 * i)) & 0x1FF;
+    block[bit >> 6] |= uint64_t(1) << (bit & 0x3F);
+  }
+}
+
+bool
+DeadNonceList::BloomFilter::mayContain(Entry entry) const
+{
+  const uint64_t* block = m_blocks + (entry & m_blockMask) * BLOOM_BLOCK_WORDS;
+  for (size_t i = 0; i < BLOOM_K; ++i) {
+    unsigned bit = (entry >> (28 + 9 * i)) & 0x1FF;
+    if ((block[bit >> 6] & (uint64_t(1) << (bit & 0x3F))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+DeadNonceList::addToFilters(Entry entry)
+{
+  m_filters[m_currentFilter].add(entry);
+  ++m_nCurrentFilterEntries;
+
+  if (m_nCurrentFilterEntries >= this->getQueueSize()) {
+    size_t nExpected = std::max(m_capacity, this->getQueueSize());
+    m_currentFilter = 1 - m_currentFilter;
+    m_filters[m_currentFilter].reset(nExpected);
+    m_nCurrentFilterEntries = 0;
+    NFD_LOG_TRACE("addToFilters rotate nExpected=" << nExpected);
+  }
+}
+
 size_t
 DeadNonceList::countMarks() const
 {
-  return m_ht.count(MARK);
+  return m_nMarks;
 }
 
 void
 DeadNonceList::mark()
 {
-  m_queue.push_back(MARK);
+  this->pushEntry(MARK);
   size_t nMarks = this->countMarks();
   m_actualMarkCounts.insert(nMarks);
 
   NFD_LOG_TRACE("mark nMarks=" << nMarks);
 
-  scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
+  m_markEvent = scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
 }
 
 void
@@ -151,6 +227,13 @@ DeadNonceList::adjustCapacity()
 
   this->evictEntries();
 
+  // grow the ring for a capacity increase, or shrink it once it is a quarter too large
+  size_t ringSize = this->computeRingSize();
+  if ((ringSize > m_ring.size() || ringSize + ringSize / 4 < m_ring.size()) &&
+      ringSize >= this->getQueueSize()) {
+    this->resizeRing(ringSize);
+  }
+
   m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval,
                                               bind(&DeadNonceList::adjustCapacity, this));
 }
@@ -158,14 +241,130 @@ DeadNonceList::adjustCapacity()
 void
 DeadNonceList::evictEntries()
 {
-  ssize_t nOverCapacity = m_queue.size() - m_capacity;
+  ssize_t nOverCapacity = this->getQueueSize() - m_capacity;
   if (nOverCapacity <= 0) // not over capacity
     return;
 
   for (ssize_t nEvict = std::min<ssize_t>(nOverCapacity, EVICT_LIMIT); nEvict > 0; --nEvict) {
-    m_queue.erase(m_queue.begin());
+    this->popEntry();
+  }
+  BOOST_ASSERT(this->getQueueSize() >= m_capacity);
+}
+
+size_t
+DeadNonceList::computeRingSize() const
+{
+  // leave room for MARKs and for entries above capacity awaiting eviction
+  return m_capacity + EVICT_LIMIT + EXPECTED_MARK_COUNT * 2;
+}
+
+void
+DeadNonceList::pushEntry(Entry entry)
+{
+  if (m_nEntries == m_ring.size()) {
+    // the queue exceeds capacity plus slack only after a capacity decrease,
+    // and evictEntries() will shrink it back
+    this->resizeRing(std::max(this->computeRingSize(), m_ring.size() + m_ring.size() / 2));
+  }
+
+  size_t pos = m_head + m_nEntries;
+  if (pos >= m_ring.size()) {
+    pos -= m_ring.size();
+  }
+  m_ring[pos] = entry;
+  ++m_nEntries;
+
+  if (entry == MARK) {
+    ++m_nMarks;
+  }
+  else {
+    this->insertToIndex(static_cast<uint32_t>(pos));
+  }
+}
+
+void
+DeadNonceList::popEntry()
+{
+  BOOST_ASSERT(m_nEntries > 0);
+  if (m_ring[m_head] == MARK) {
+    --m_nMarks;
+  }
+  else {
+    this->eraseFromIndex(static_cast<uint32_t>(m_head));
+  }
+  if (++m_head == m_ring.size()) {
+    m_head = 0;
+  }
+  --m_nEntries;
+}
+
+void
+DeadNonceList::resizeRing(size_t ringSize)
+{
+  BOOST_ASSERT(ringSize >= m_nEntries);
+  BOOST_ASSERT(ringSize < EMPTY_SLOT);
+  NFD_LOG_TRACE("resizeRing " << m_ring.size() << " => " << ringSize);
+
+  std::vector<Entry> ring(ringSize);
+  for (size_t i = 0, pos = m_head; i < m_nEntries; ++i) {
+    ring[i] = m_ring[pos];
+    if (++pos == m_ring.size()) {
+      pos = 0;
+    }
+  }
+  m_ring.swap(ring);
+  m_head = 0;
+
+  m_slots.assign(ringSize + ringSize / 2, EMPTY_SLOT);
+  for (size_t pos = 0; pos < m_nEntries; ++pos) {
+    if (m_ring[pos] != MARK) {
+      this->insertToIndex(static_cast<uint32_t>(pos));
+    }
+  }
+}
+
+bool
+DeadNonceList::findInIndex(Entry entry) const
+{
+  for (size_t i = this->getHomeSlot(entry); m_slots[i] != EMPTY_SLOT; i = this->getNextSlot(i)) {
+    if (m_ring[m_slots[i]] == entry) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadNonceList::insertToIndex(uint32_t pos)
+{
+  size_t i = this->getHomeSlot(m_ring[pos]);
+  while (m_slots[i] != EMPTY_SLOT) {
+    i = this->getNextSlot(i);
+  }
+  m_slots[i] = pos;
+}
+
+void
+DeadNonceList::eraseFromIndex(uint32_t pos)
+{
+  size_t i = this->getHomeSlot(m_ring[pos]);
+  while (m_slots[i] != pos) {
+    BOOST_ASSERT(m_slots[i] != EMPTY_SLOT);
+    i = this->getNextSlot(i);
+  }
+
+  // backward shift deletion: move later entries of the probe sequence into the hole,
+  // so that lookups never need tombstones
+  size_t nSlots = m_slots.size();
+  for (size_t j = this->getNextSlot(i); m_slots[j] != EMPTY_SLOT; j = this->getNextSlot(j)) {
+    size_t home = this->getHomeSlot(m_ring[m_slots[j]]);
+    // the entry at j may fill the hole at i if its home is not in the cyclic range (i, j]
+    if ((j + nSlots - home) % nSlots >= (j + nSlots - i) % nSlots) {
+      m_slots[i] = m_slots[j];
+      i = j;
+    }
   }
-  BOOST_ASSERT(m_queue.size() >= m_capacity);
+  m_slots[i] = EMPTY_SLOT;
 }
 
 } // namespace nfd
@@ -27,9 +27,6 @@
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
 #include "core/common.hpp"
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index/hashed_index.hpp>
 #include "core/scheduler.hpp"
 
 namespace nfd {
@@ -45,11 +42,21 @@ namespace nfd {
  *  but the probability is small, and the error is recoverable when consumer retransmits
  *  with a different Nonce.
  *
+ *  Entries are kept in insertion order in a ring buffer, and are located through an
+ *  open-addressed hash index of ring positions, so that no memory is allocated per entry.
+ *  The ring is sized to the capacity plus a small slack, and the index has 1.5 slots per
+ *  ring position. Together with the Bloom filters described below, each entry costs
+ *  about 8 (ring) + 6 (index) + 4 to 8 (filters) = 18 to 22 octets.
+ *
  *  To reduce memory usage, entries do not have associated timestamps. Instead,
  *  lifetime of entries is controlled by dynamically adjusting the capacity of the container.
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Most lookups are for Nonces that are not in the list. These are answered by a rotating
+ *  pair of blocked Bloom filters in front of the container, and the container itself is
+ *  consulted only if the filters report a possible match.
  */
 class DeadNonceList : noncopyable
 {
@@ -94,18 +101,107 @@ private: // Entry and Index
   static Entry
   makeEntry(const Name& name, uint32_t nonce);
 
-  typedef boost::multi_index_container<
-    Entry,
-    boost::multi_index::indexed_by<
-      boost::multi_index::sequenced<>,
-      boost::multi_index::hashed_non_unique<
-        boost::multi_index::identity<Entry>
-      >
-    >
-  > Index;
+  /** \return number of entries in the ring, including MARKs
+   */
+  size_t
+  getQueueSize() const
+  {
+    return m_nEntries;
+  }
+
+  /** \brief append \p entry to the ring, and index it unless it is a MARK
+   */
+  void
+  pushEntry(Entry entry);
+
+  /** \brief remove the oldest entry from the ring and the index
+   *  \pre getQueueSize() > 0
+   */
+  void
+  popEntry();
 
-  typedef Index::nth_index<0>::type Queue;
-  typedef Index::nth_index<1>::type Hashtable;
+  /** \brief move entries into a ring of \p ringSize slots, and rebuild the index
+   *  \pre ringSize >= getQueueSize()
+   */
+  void
+  resizeRing(size_t ringSize);
+
+  /** \return ring size suitable for the current capacity
+   */
+  size_t
+  computeRingSize() const;
+
+  /** \return home slot of \p entry in the index
+   */
+  size_t
+  getHomeSlot(Entry entry) const
+  {
+    // maps the lower 32 bits of the hash onto [0, m_slots.size()) without a division
+    return static_cast<size_t>(((entry & 0xFFFFFFFF) * m_slots.size()) >> 32);
+  }
+
+  /** \return slot following \p slot in the index, wrapping around at the end
+   */
+  size_t
+  getNextSlot(size_t slot) const
+  {
+    return ++slot == m_slots.size() ? 0 : slot;
+  }
+
+  /** \brief determine whether a non-MARK \p entry is in the index
+   */
+  bool
+  findInIndex(Entry entry) const;
+
+  /** \brief index the entry at ring position \p pos
+   */
+  void
+  insertToIndex(uint32_t pos);
+
+  /** \brief unindex the entry at ring position \p pos
+   */
+  void
+  eraseFromIndex(uint32_t pos);
+
+private: // Bloom filter
+  /** \brief a blocked Bloom filter of Entry
+   *
+   *  Each Entry sets BLOOM_K bits within one 64-octet block,
+   *  so that a query touches only one cache line.
+   *  The filter has no false negatives, and does not support deletion.
+   */
+  class BloomFilter : noncopyable
+  {
+  public:
+    /** \brief clear the filter, and size it for \p nExpected entries
+     */
+    void
+    reset(size_t nExpected);
+
+    void
+    add(Entry entry);
+
+    /** \return false if \p entry has not been added since last reset;
+     *          true if it may have been added
+     */
+    bool
+    mayContain(Entry entry) const;
+
+  private:
+    std::vector<uint64_t> m_storage;
+    uint64_t* m_blocks; ///< m_storage aligned to cache line
+    size_t m_blockMask;
+  };
+
+  /** \brief record \p entry in the current filter, and rotate filters if necessary
+   *
+   *  Filters are rotated when the current filter has seen at least as many entries as
+   *  the index holds. At that point, every entry in the index is in the current filter,
+   *  so the previous filter can be cleared and reused. This ensures that every entry
+   *  in the index is in one of the two filters.
+   */
+  void
+  addToFilters(Entry entry);
 
 private: // actual lifetime estimation and capacity control
   /** \return number of MARKs in the index
@@ -140,9 +236,34 @@ public:
 
 private:
   time::nanoseconds m_lifetime;
-  Index m_index;
-  Queue& m_queue;
-  Hashtable& m_ht;
+
+  /** \brief entries in insertion order
+   *
+   *  The m_nEntries valid entries start at position m_head, and wrap around at the end.
+   */
+  std::vector<Entry> m_ring;
+  size_t m_head;
+  size_t m_nEntries;
+  size_t m_nMarks;
+
+  /** \brief open-addressed hash index with linear probing
+   *
+   *  Each slot holds the ring position of a non-MARK entry, or EMPTY_SLOT.
+   *  It has 1.5 slots per ring position, so the load factor is at most 2/3,
+   *  and is usually lower because the ring is not full.
+   */
+  std::vector<uint32_t> m_slots;
+  static const uint32_t EMPTY_SLOT;
+
+  BloomFilter m_filters[2];
+  size_t m_currentFilter; ///< index of the filter that receives new entries
+  size_t m_nCurrentFilterEntries; ///< number of entries added to the current filter
+
+  /// number of filter bits per expected entry
+  static const size_t BLOOM_BITS_PER_ENTRY;
+
+  /// number of bits set by each entry
+  static const size_t BLOOM_K;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity control
 
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FACE_INDEX_HPP
+#define NFD_DAEMON_TABLE_FACE_INDEX_HPP
+
+#include "core/common.hpp"
+#include "face/face.hpp"
+
+namespace nfd {
+
+/** \brief an index of table entries by the faces they refer to
+ *  \tparam E a table entry type, such as fib::Entry
+ *
+ *  A table keeps an index of this type so that the entries referring to a face can be found
+ *  without enumerating the NameTree. The table entry is responsible for keeping its own
+ *  index records up to date when it gains or loses a reference to a face.
+ */
+template<typename E>
+class FaceIndex : noncopyable
+{
+public:
+  /** \brief records that \p entry refers to \p face
+   *
+   *  If such a record already exists, this is a no-op.
+   */
+  void
+  insert(const Face& face, E* entry)
+  {
+    BOOST_ASSERT(entry != nullptr);
+    m_index[&face].insert(entry);
+  }
+
+  /** \brief records that \p entry no longer refers to \p face
+   *
+   *  If no such record exists, this is a no-op.
+   */
+  void
+  erase(const Face& face, E* entry)
+  {
+    auto it = m_index.find(&face);
+    if (it == m_index.end()) {
+      return;
+    }
+
+    it->second.erase(entry);
+    if (it->second.empty()) {
+      m_index.erase(it);
+    }
+  }
+
+  /** \return entries that refer to \p face
+   *  \note The returned collection is a snapshot, which is not invalidated when entries
+   *        are modified or erased afterwards.
+   */
+  std::vector<E*>
+  find(const Face& face) const
+  {
+    auto it = m_index.find(&face);
+    if (it == m_index.end()) {
+      return {};
+    }
+    return std::vector<E*>(it->second.begin(), it->second.end());
+  }
+
+  /** \return number of entries that refer to \p face
+   */
+  size_t
+  count(const Face& face) const
+  {
+    auto it = m_index.find(&face);
+    return it == m_index.end() ? 0 : it->second.size();
+  }
+
+private:
+  std::unordered_map<const Face*, std::unordered_set<E*>> m_index;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FACE_INDEX_HPP
@@ -28,9 +28,13 @@
 namespace nfd {
 namespace fib {
 
+constexpr size_t Entry::MAX_TRACKED_NEXTHOPS;
+
 Entry::Entry(const Name& prefix)
   : m_prefix(prefix)
+  , m_usableNextHops(0)
   , m_nameTreeEntry(nullptr)
+  , m_faceIndex(nullptr)
 {
 }
 
@@ -56,6 +60,10 @@ Entry::addNextHop(Face& face, uint64_t cost)
   if (it == m_nextHops.end()) {
     m_nextHops.emplace_back(face);
     it = std::prev(m_nextHops.end());
+
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->insert(face, this);
+    }
   }
 
   it->setCost(cost);
@@ -68,6 +76,11 @@ Entry::removeNextHop(const Face& face)
   auto it = this->findNextHop(face);
   if (it != m_nextHops.end()) {
     m_nextHops.erase(it);
+    this->updateUsableNextHops();
+
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->erase(face, this);
+    }
   }
 }
 
@@ -76,6 +89,20 @@ Entry::sortNextHops()
 {
   std::sort(m_nextHops.begin(), m_nextHops.end(),
             [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); });
+  this->updateUsableNextHops();
+}
+
+void
+Entry::updateUsableNextHops()
+{
+  uint64_t mask = 0;
+  size_t nTracked = std::min(m_nextHops.size(), MAX_TRACKED_NEXTHOPS);
+  for (size_t i = 0; i < nTracked; ++i) {
+    if (m_nextHops[i].getFace().getState() == face::FaceState::UP) {
+      mask |= uint64_t(1) << i;
+    }
+  }
+  m_usableNextHops = mask;
 }
 
 } // namespace fib
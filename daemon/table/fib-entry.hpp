@@ -27,6 +27,12 @@
 #define NFD_DAEMON_TABLE_FIB_ENTRY_HPP
 
 #include "fib-nexthop.hpp"
+#include "face-index.hpp"
+
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 105800
+#include <boost/container/small_vector.hpp>
+#endif // BOOST_VERSION >= 105800
 
 namespace nfd {
 
@@ -36,6 +42,8 @@ class Entry;
 
 namespace fib {
 
+class Fib;
+
 /** \class NextHopList
  *  \brief represents a collection of nexthops
  *
@@ -43,8 +51,15 @@ namespace fib {
  *    iterator<NextHop> begin()
  *    iterator<NextHop> end()
  *    size_t size()
+ *
+ *  The first few nexthops are stored inline in the FIB entry, so that a strategy
+ *  can choose among them without following a pointer to a separate allocation.
  */
+#if BOOST_VERSION >= 105800
+typedef boost::container::small_vector<fib::NextHop, 4> NextHopList;
+#else
 typedef std::vector<fib::NextHop> NextHopList;
+#endif // BOOST_VERSION >= 105800
 
 /** \brief represents a FIB entry
  */
@@ -79,6 +94,26 @@ public:
   bool
   hasNextHop(const Face& face) const;
 
+  /** \return whether the face of the nexthop at \p index in getNextHops() is up
+   *
+   *  This is answered from a bitmask kept in the entry, without accessing the face.
+   *  Nexthops after the first MAX_TRACKED_NEXTHOPS are always considered usable.
+   */
+  bool
+  isNextHopUsable(size_t index) const
+  {
+    BOOST_ASSERT(index < m_nextHops.size());
+    return index >= MAX_TRACKED_NEXTHOPS || ((m_usableNextHops >> index) & 1) != 0;
+  }
+
+  /** \return whether the face of any nexthop is up
+   */
+  bool
+  hasUsableNextHops() const
+  {
+    return m_usableNextHops != 0 || m_nextHops.size() > MAX_TRACKED_NEXTHOPS;
+  }
+
   /** \brief adds a NextHop record
    *
    *  If a NextHop record for \p face already exists, its cost is updated.
@@ -104,13 +139,37 @@ private:
   void
   sortNextHops();
 
+  /** \brief recomputes the usable nexthops bitmask from face states
+   *
+   *  This is invoked whenever the nexthop list changes, and by Fib when a face
+   *  referred to by this entry changes state.
+   */
+  void
+  updateUsableNextHops();
+
+public:
+  /** \brief number of nexthops whose usability is tracked in the bitmask
+   */
+  static constexpr size_t MAX_TRACKED_NEXTHOPS = 64;
+
 private:
   Name m_prefix;
   NextHopList m_nextHops;
 
+  /** \brief bit i is set if the face of m_nextHops[i] is up
+   */
+  uint64_t m_usableNextHops;
+
   name_tree::Entry* m_nameTreeEntry;
 
+  /** \brief the face index of the FIB this entry belongs to
+   *
+   *  This is nullptr if the entry is not part of a FIB.
+   */
+  FaceIndex<Entry>* m_faceIndex;
+
   friend class name_tree::Entry;
+  friend class Fib;
 };
 
 } // namespace fib
@@ -96,14 +96,22 @@ Fib::insert(const Name& prefix)
   }
 
   nte.setFibEntry(make_unique<Entry>(prefix));
+  entry = nte.getFibEntry();
+  entry->m_faceIndex = &m_faceIndex;
   ++m_nItems;
-  return std::make_pair(nte.getFibEntry(), true);
+  return std::make_pair(entry, true);
 }
 
 void
 Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
+  BOOST_ASSERT(nte->getFibEntry() != nullptr);
+
+  Entry* entry = nte->getFibEntry();
+  for (const NextHop& nexthop : entry->getNextHops()) {
+    m_faceIndex.erase(nexthop.getFace(), entry);
+  }
 
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
@@ -116,7 +124,7 @@ void
 Fib::erase(const Name& prefix)
 {
   name_tree::Entry* nte = m_nameTree.findExactMatch(prefix);
-  if (nte != nullptr) {
+  if (nte != nullptr && nte->getFibEntry() != nullptr) {
     this->erase(nte);
   }
 }
@@ -143,6 +151,14 @@ Fib::removeNextHop(Entry& entry, const Face& face)
   }
 }
 
+void
+Fib::updateUsableNextHops(const Face& face)
+{
+  for (Entry* entry : m_faceIndex.find(face)) {
+    entry->updateUsableNextHops();
+  }
+}
+
 Fib::Range
 Fib::getRange() const
 {
@@ -81,6 +81,17 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+  /** \brief finds all entries that have a NextHop record for \p face
+   *
+   *  This uses a per-face index and does not enumerate the NameTree.
+   *  \return a snapshot of matching entries, in unspecified order
+   */
+  std::vector<Entry*>
+  findEntriesByFace(const Face& face) const
+  {
+    return m_faceIndex.find(face);
+  }
+
 public: // mutation
   /** \brief inserts a FIB entry for prefix
    *
@@ -101,6 +112,14 @@ public: // mutation
   void
   removeNextHop(Entry& entry, const Face& face);
 
+  /** \brief refreshes the usable nexthops of entries that refer to \p face
+   *
+   *  This should be invoked after the state of \p face has changed.
+   *  \sa Entry::isNextHopUsable
+   */
+  void
+  updateUsableNextHops(const Face& face);
+
 public: // enumeration
   typedef boost::transformed_range<name_tree::GetTableEntry<Entry>, const name_tree::Range> Range;
   typedef boost::range_iterator<Range>::type const_iterator;
@@ -141,6 +160,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  FaceIndex<Entry> m_faceIndex;
 
   /** \brief the empty FIB entry.
    *
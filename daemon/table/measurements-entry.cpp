@@ -30,7 +30,11 @@ namespace measurements {
 
 Entry::Entry(const Name& name)
   : m_name(name)
-  , m_expiry(time::steady_clock::TimePoint::min())
+  , m_expiryPrev(nullptr)
+  , m_expiryNext(nullptr)
+  , m_expiryTick(0)
+  , m_lruPrev(nullptr)
+  , m_lruNext(nullptr)
   , m_nameTreeEntry(nullptr)
 {
 }
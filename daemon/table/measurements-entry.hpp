@@ -53,8 +53,27 @@ public:
 
 private:
   Name m_name;
+
+  /** \brief expiration time
+   *
+   *  Extending the lifetime only updates this field. The entry stays in the expiry bucket
+   *  of an earlier tick, and is moved to a later bucket when that bucket is swept.
+   */
   time::steady_clock::TimePoint m_expiry;
-  scheduler::EventId m_cleanup;
+
+  /** \brief neighbors in Measurements expiry bucket
+   */
+  Entry* m_expiryPrev;
+  Entry* m_expiryNext;
+
+  /** \brief tick of the expiry bucket that contains this entry
+   */
+  uint64_t m_expiryTick;
+
+  /** \brief neighbors in Measurements least-recently-used list
+   */
+  Entry* m_lruPrev;
+  Entry* m_lruNext;
 
   name_tree::Entry* m_nameTreeEntry;
 
@@ -27,14 +27,28 @@
 #include "name-tree.hpp"
 #include "pit-entry.hpp"
 #include "fib-entry.hpp"
+#include "core/logger.hpp"
 
 namespace nfd {
 namespace measurements {
 
+NFD_LOG_INIT("Measurements");
+
+constexpr size_t Measurements::N_EXPIRY_BUCKETS;
+
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_limit(std::numeric_limits<size_t>::max())
+  , m_nEvictions(0)
+  , m_lruHead(nullptr)
+  , m_lruTail(nullptr)
+  , m_origin(time::steady_clock::now())
+  , m_nextTick(0)
+  , m_sweepTick(std::numeric_limits<uint64_t>::max())
+  , m_isEvictionScheduled(false)
 {
+  m_expiryBuckets.fill(nullptr);
 }
 
 Entry&
@@ -42,16 +56,26 @@ Measurements::get(name_tree::Entry& nte)
 {
   Entry* entry = nte.getMeasurementsEntry();
   if (entry != nullptr) {
+    this->lruUnlink(*entry);
+    this->lruPushFront(*entry);
     return *entry;
   }
 
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (m_nItems == 0) {
+    // all buckets are empty, so skip the ticks that ended while the table was empty
+    m_nextTick = std::max(m_nextTick, this->toTick(now));
+  }
+
   nte.setMeasurementsEntry(make_unique<Entry>(nte.getName()));
   ++m_nItems;
   entry = nte.getMeasurementsEntry();
 
-  entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(),
-                                         bind(&Measurements::cleanup, this, ref(*entry)));
+  this->lruPushFront(*entry);
+  entry->m_expiry = now + getInitialLifetime();
+  this->placeExpiry(*entry);
+
+  this->scheduleEviction();
 
   return *entry;
 }
@@ -129,27 +153,207 @@ Measurements::extendLifetime(Entry& entry, const time::nanoseconds& lifetime)
 {
   BOOST_ASSERT(m_nameTree.getEntry(entry) != nullptr);
 
-  time::steady_clock::TimePoint expiry = time::steady_clock::now() + lifetime;
-  if (entry.m_expiry >= expiry) {
-    // has longer lifetime, not extending
-    return;
-  }
+  this->lruUnlink(entry);
+  this->lruPushFront(entry);
+
+  // the entry stays in its bucket, which is not later than the new expiration time
+  entry.m_expiry = std::max(entry.m_expiry, time::steady_clock::now() + lifetime);
+}
 
-  scheduler::cancel(entry.m_cleanup);
-  entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, bind(&Measurements::cleanup, this, ref(entry)));
+void
+Measurements::setLimit(size_t nMaxEntries)
+{
+  m_limit = std::max(nMaxEntries, static_cast<size_t>(1));
+  this->evictEntries();
 }
 
 void
-Measurements::cleanup(Entry& entry)
+Measurements::erase(Entry& entry)
 {
   name_tree::Entry* nte = m_nameTree.getEntry(entry);
   BOOST_ASSERT(nte != nullptr);
 
+  this->lruUnlink(entry);
+  this->unlinkExpiry(entry);
+
   nte->setMeasurementsEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
 }
 
+void
+Measurements::evictEntries()
+{
+  while (m_nItems > m_limit) {
+    BOOST_ASSERT(m_lruTail != nullptr);
+    NFD_LOG_DEBUG("evict " << m_lruTail->getName());
+    this->erase(*m_lruTail);
+    ++m_nEvictions;
+  }
+}
+
+void
+Measurements::scheduleEviction()
+{
+  if (m_nItems <= m_limit || m_isEvictionScheduled) {
+    return;
+  }
+
+  // callers may hold references to other entries across get() and getParent(),
+  // so entries are not evicted until the current packet has been processed
+  m_isEvictionScheduled = true;
+  m_evictionEvent = scheduler::schedule(time::nanoseconds::zero(), [this] {
+    m_isEvictionScheduled = false;
+    this->evictEntries();
+  });
+}
+
+void
+Measurements::lruPushFront(Entry& entry)
+{
+  BOOST_ASSERT(entry.m_lruPrev == nullptr && entry.m_lruNext == nullptr);
+
+  entry.m_lruNext = m_lruHead;
+  if (m_lruHead != nullptr) {
+    m_lruHead->m_lruPrev = &entry;
+  }
+  else {
+    m_lruTail = &entry;
+  }
+  m_lruHead = &entry;
+}
+
+void
+Measurements::lruUnlink(Entry& entry)
+{
+  if (entry.m_lruPrev != nullptr) {
+    entry.m_lruPrev->m_lruNext = entry.m_lruNext;
+  }
+  else {
+    m_lruHead = entry.m_lruNext;
+  }
+
+  if (entry.m_lruNext != nullptr) {
+    entry.m_lruNext->m_lruPrev = entry.m_lruPrev;
+  }
+  else {
+    m_lruTail = entry.m_lruPrev;
+  }
+
+  entry.m_lruPrev = entry.m_lruNext = nullptr;
+}
+
+uint64_t
+Measurements::toTick(const time::steady_clock::TimePoint& t) const
+{
+  if (t <= m_origin) {
+    return 0;
+  }
+  return static_cast<uint64_t>((t - m_origin) / getSweepInterval());
+}
+
+void
+Measurements::placeExpiry(Entry& entry)
+{
+  BOOST_ASSERT(entry.m_expiryPrev == nullptr && entry.m_expiryNext == nullptr);
+
+  // the entry belongs to the tick at whose end it expires
+  uint64_t tick = this->toTick(entry.m_expiry - time::nanoseconds(1));
+  tick = std::min(std::max(tick, m_nextTick), m_nextTick + N_EXPIRY_BUCKETS - 1);
+  Entry*& head = m_expiryBuckets[tick % N_EXPIRY_BUCKETS];
+  entry.m_expiryTick = tick;
+  entry.m_expiryNext = head;
+  if (head != nullptr) {
+    head->m_expiryPrev = &entry;
+  }
+  head = &entry;
+
+  this->scheduleSweep(tick);
+}
+
+void
+Measurements::unlinkExpiry(Entry& entry)
+{
+  Entry*& head = m_expiryBuckets[entry.m_expiryTick % N_EXPIRY_BUCKETS];
+  if (entry.m_expiryPrev != nullptr) {
+    entry.m_expiryPrev->m_expiryNext = entry.m_expiryNext;
+  }
+  else if (head == &entry) {
+    head = entry.m_expiryNext;
+  }
+
+  if (entry.m_expiryNext != nullptr) {
+    entry.m_expiryNext->m_expiryPrev = entry.m_expiryPrev;
+  }
+
+  entry.m_expiryPrev = entry.m_expiryNext = nullptr;
+}
+
+void
+Measurements::sweep()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  uint64_t endTick = this->toTick(now);
+  // moved entries do not schedule the sweeper; it is scheduled once after all buckets are swept
+  m_sweepTick = 0;
+
+  // if more ticks than buckets have ended, every bucket is swept once
+  if (endTick > m_nextTick + N_EXPIRY_BUCKETS) {
+    m_nextTick = endTick - N_EXPIRY_BUCKETS;
+  }
+
+  size_t nErased = 0;
+  size_t nMoved = 0;
+  while (m_nextTick < endTick) {
+    // detach the bucket before moving its entries, because an entry expiring beyond the ring
+    // is moved into the same bucket
+    Entry*& head = m_expiryBuckets[m_nextTick % N_EXPIRY_BUCKETS];
+    Entry* entry = head;
+    head = nullptr;
+    ++m_nextTick;
+
+    while (entry != nullptr) {
+      Entry* next = entry->m_expiryNext;
+      entry->m_expiryPrev = entry->m_expiryNext = nullptr;
+      if (entry->m_expiry <= now) {
+        this->erase(*entry);
+        ++nErased;
+      }
+      else {
+        this->placeExpiry(*entry);
+        ++nMoved;
+      }
+      entry = next;
+    }
+  }
+  NFD_LOG_TRACE("sweep erased=" << nErased << " moved=" << nMoved << " remaining=" << m_nItems);
+
+  m_sweepTick = std::numeric_limits<uint64_t>::max();
+  if (m_nItems == 0) {
+    return;
+  }
+  for (uint64_t tick = m_nextTick; tick < m_nextTick + N_EXPIRY_BUCKETS; ++tick) {
+    if (m_expiryBuckets[tick % N_EXPIRY_BUCKETS] != nullptr) {
+      this->scheduleSweep(tick);
+      break;
+    }
+  }
+}
+
+void
+Measurements::scheduleSweep(uint64_t tick)
+{
+  if (tick >= m_sweepTick) {
+    return;
+  }
+
+  m_sweepTick = tick;
+  // the sweeper runs at the end of the tick, which is the start of the next tick
+  time::steady_clock::TimePoint when = m_origin +
+                                       getSweepInterval() * static_cast<time::nanoseconds::rep>(tick + 1);
+  time::nanoseconds delay = std::max(when - time::steady_clock::now(), time::nanoseconds::zero());
+  m_sweepEvent = scheduler::schedule(delay, bind(&Measurements::sweep, this));
+}
+
 } // namespace measurements
 } // namespace nfd
@@ -29,6 +29,8 @@
 #include "measurements-entry.hpp"
 #include "name-tree.hpp"
 
+#include <array>
+
 namespace nfd {
 
 namespace fib {
@@ -71,6 +73,15 @@ public:
 };
 
 /** \brief represents the Measurements table
+ *
+ *  Each entry has an expiration time, which can be extended with extendLifetime.
+ *  Time is divided into ticks of getSweepInterval(). Entries are kept in a ring of expiry
+ *  buckets, one per tick, and expired entries are erased in batches by a sweeper at the end
+ *  of each tick, so an entry is erased at the first tick boundary not earlier than its
+ *  expiration time.
+ *  The number of entries can be capped with setLimit;
+ *  when the table is over its limit, the least recently used entries are evicted
+ *  soon after the entry that exceeds the limit is inserted.
  */
 class Measurements : noncopyable
 {
@@ -79,6 +90,11 @@ public:
   Measurements(NameTree& nametree);
 
   /** \brief find or insert a Measurements entry for \p name
+   *
+   *  The entry becomes the most recently used entry.
+   *  \note If the table is full, inserting an entry causes the least recently used entries to be
+   *        evicted after the current event has been processed, so that references to entries
+   *        held by the caller stay valid until then.
    */
   Entry&
   get(const Name& name);
@@ -119,9 +135,16 @@ public:
   static time::nanoseconds
   getInitialLifetime();
 
+  /** \brief duration of a tick, which is the minimum duration between two runs of the sweeper
+   */
+  static time::nanoseconds
+  getSweepInterval();
+
   /** \brief extend lifetime of an entry
    *
-   *  The entry will be kept until at least now()+lifetime.
+   *  The entry will be kept until at least now()+lifetime, unless it is evicted.
+   *  The entry becomes the most recently used entry.
+   *  This takes constant time and does not allocate memory.
    */
   void
   extendLifetime(Entry& entry, const time::nanoseconds& lifetime);
@@ -129,13 +152,88 @@ public:
   size_t
   size() const;
 
-private:
+  /** \brief change capacity (in number of entries)
+   *
+   *  If the table has more entries than \p nMaxEntries, the least recently used
+   *  entries are evicted immediately.
+   */
   void
-  cleanup(Entry& entry);
+  setLimit(size_t nMaxEntries);
+
+  /** \return capacity (in number of entries)
+   */
+  size_t
+  getLimit() const
+  {
+    return m_limit;
+  }
+
+  /** \return number of entries evicted because the table was over its limit
+   */
+  uint64_t
+  getNEvictions() const
+  {
+    return m_nEvictions;
+  }
 
+private:
   Entry&
   get(name_tree::Entry& nte);
 
+  /** \brief erases an entry, and its NameTree entry if it becomes empty
+   */
+  void
+  erase(Entry& entry);
+
+  /** \brief evicts least recently used entries until size() <= getLimit()
+   */
+  void
+  evictEntries();
+
+  /** \brief schedules evictEntries if the table is over its limit
+   */
+  void
+  scheduleEviction();
+
+  /** \brief makes \p entry the most recently used entry
+   *  \pre entry is not in LRU list
+   */
+  void
+  lruPushFront(Entry& entry);
+
+  /** \brief removes \p entry from LRU list
+   */
+  void
+  lruUnlink(Entry& entry);
+
+  /** \return number of whole ticks between the origin and \p t
+   */
+  uint64_t
+  toTick(const time::steady_clock::TimePoint& t) const;
+
+  /** \brief puts \p entry into the expiry bucket of its expiration time,
+   *         or the last bucket if its expiration time is beyond the ring
+   *  \pre entry is not in an expiry bucket
+   */
+  void
+  placeExpiry(Entry& entry);
+
+  /** \brief removes \p entry from its expiry bucket, if any
+   */
+  void
+  unlinkExpiry(Entry& entry);
+
+  /** \brief erases expired entries in the buckets of ticks that have ended,
+   *         and moves other entries in those buckets to later buckets
+   */
+  void
+  sweep();
+
+  /** \brief ensures the sweeper runs at the end of \p tick
+   */
+  void
+  scheduleSweep(uint64_t tick);
+
   /** \tparam K a parameter acceptable to NameTree::findLongestPrefixMatch
    */
   template<typename K>
@@ -145,6 +243,35 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  size_t m_limit;
+  uint64_t m_nEvictions;
+
+  /** \brief least recently used list; head is the most recently used entry
+   */
+  Entry* m_lruHead;
+  Entry* m_lruTail;
+
+  static constexpr size_t N_EXPIRY_BUCKETS = 256;
+
+  /** \brief heads of expiry buckets; bucket i contains entries of ticks t where t % size == i
+   *
+   *  The buckets cover ticks m_nextTick .. m_nextTick+N_EXPIRY_BUCKETS-1.
+   */
+  std::array<Entry*, N_EXPIRY_BUCKETS> m_expiryBuckets;
+  const time::steady_clock::TimePoint m_origin;
+
+  /** \brief first tick whose bucket has not been swept
+   */
+  uint64_t m_nextTick;
+
+  scheduler::ScopedEventId m_sweepEvent;
+
+  /** \brief tick at whose end the sweeper is scheduled, or max if not scheduled
+   */
+  uint64_t m_sweepTick;
+
+  scheduler::ScopedEventId m_evictionEvent;
+  bool m_isEvictionScheduled;
 };
 
 inline time::nanoseconds
@@ -153,6 +280,12 @@ Measurements::getInitialLifetime()
   return time::seconds(4);
 }
 
+inline time::nanoseconds
+Measurements::getSweepInterval()
+{
+  return time::milliseconds(100);
+}
+
 inline size_t
 Measurements::size() const
 {
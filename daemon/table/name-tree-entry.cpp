@@ -32,6 +32,8 @@ Entry::Entry(const Name& name, Node* node)
   : m_name(name)
   , m_node(node)
   , m_parent(nullptr)
+  , m_cachedStrategy(nullptr)
+  , m_cachedStrategyGeneration(0)
 {
   BOOST_ASSERT(node != nullptr);
 }
@@ -90,8 +92,8 @@ Entry::insertPitEntry(shared_ptr<pit::Entry> pitEntry)
   BOOST_ASSERT(pitEntry != nullptr);
   BOOST_ASSERT(pitEntry->m_nameTreeEntry == nullptr);
 
-  m_pitEntries.push_back(pitEntry);
   pitEntry->m_nameTreeEntry = this;
+  m_pitEntries.push_back(std::move(pitEntry));
 }
 
 void
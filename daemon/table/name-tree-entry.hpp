@@ -152,6 +152,27 @@ public: // attached table entries
   void
   setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceEntry);
 
+public: // effective strategy cache
+  /** \return effective strategy cached by StrategyChoice in \p generation,
+   *          or nullptr if the cached strategy was stored in another generation
+   */
+  fw::Strategy*
+  getCachedStrategy(uint64_t generation) const
+  {
+    return m_cachedStrategyGeneration == generation ? m_cachedStrategy : nullptr;
+  }
+
+  /** \brief caches the effective strategy of this entry
+   *  \param strategy the effective strategy
+   *  \param generation the StrategyChoice generation in which \p strategy is effective
+   */
+  void
+  setCachedStrategy(fw::Strategy& strategy, uint64_t generation) const
+  {
+    m_cachedStrategy = &strategy;
+    m_cachedStrategyGeneration = generation;
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    *  \note This function is for NameTree internal use. Other components
@@ -175,6 +196,9 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+  mutable fw::Strategy* m_cachedStrategy;
+  mutable uint64_t m_cachedStrategyGeneration;
+
   friend Node* getNode(const Entry& entry);
 };
 
@@ -198,6 +198,16 @@ public:
   const Node*
   find(const Name& name, size_t prefixLen) const;
 
+  /** \brief starts loading the bucket for hash value \p h into cache
+   */
+  void
+  prefetch(HashValue h) const
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(&m_buckets[this->computeBucketIndex(h)]);
+#endif
+  }
+
   /** \brief find node for name.getPrefix(prefixLen)
    *  \pre name.size() > prefixLen
    *  \pre hashes == computeHashes(name)
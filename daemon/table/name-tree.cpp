@@ -157,14 +157,29 @@ NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySel
 {
   HashSequence hashes = computeHashes(name);
 
-  for (ssize_t prefixLen = name.size(); prefixLen >= 0; --prefixLen) {
+  // Every ancestor of a NameTree entry is also in the NameTree, so whether name.getPrefix(len)
+  // has an entry is monotonic in len. Binary search finds the deepest existing prefix with
+  // O(log n) hashtable lookups; the longest match is then found by walking up parent pointers,
+  // which does not need further lookups.
+  const Node* deepest = nullptr;
+  ssize_t low = 0;
+  ssize_t high = name.size();
+  while (low <= high) {
+    ssize_t prefixLen = low + (high - low + 1) / 2;
     const Node* node = m_ht.find(name, prefixLen, hashes);
-    if (node != nullptr && entrySelector(node->entry)) {
-      return &node->entry;
+    if (node != nullptr) {
+      deepest = node;
+      low = prefixLen + 1;
+    }
+    else {
+      high = prefixLen - 1;
     }
   }
 
-  return nullptr;
+  if (deepest == nullptr) {
+    return nullptr;
+  }
+  return this->findLongestPrefixMatch(deepest->entry, entrySelector);
 }
 
 Entry*
@@ -135,6 +135,17 @@ public: // mutation
   eraseIfEmpty(Entry* entry, bool canEraseAncestors = true);
 
 public: // matching
+  /** \brief hints that the entry of \p name will be looked up soon
+   *
+   *  This starts loading the hashtable bucket of \p name.getPrefix(getMaxDepth()) into cache,
+   *  so that a batch of packets can overlap their memory accesses.
+   */
+  void
+  prefetch(const Name& name) const
+  {
+    m_ht.prefetch(computeHash(name, std::min(name.size(), getMaxDepth())));
+  }
+
   /** \brief exact match lookup
    *  \return entry with \p name.getPrefix(prefixLen), or nullptr if it does not exist
    */
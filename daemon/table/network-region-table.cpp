@@ -24,18 +24,41 @@
  */
 
 #include "network-region-table.hpp"
-#include <boost/range/adaptor/map.hpp>
+#include "name-tree-hashtable.hpp"
 
 namespace nfd {
 
+size_t
+NetworkRegionTable::PrefixHash::operator()(const Name& prefix) const
+{
+  return name_tree::computeHash(prefix);
+}
+
+std::pair<NetworkRegionTable::const_iterator, bool>
+NetworkRegionTable::insert(const Name& region)
+{
+  auto res = m_regions.insert(region);
+  if (res.second) {
+    for (size_t prefixLen = 0; prefixLen <= region.size(); ++prefixLen) {
+      m_prefixes.insert(region.getPrefix(prefixLen));
+    }
+  }
+  return res;
+}
+
+void
+NetworkRegionTable::clear()
+{
+  m_regions.clear();
+  m_prefixes.clear();
+}
+
 bool
 NetworkRegionTable::isInProducerRegion(const DelegationList& forwardingHint) const
 {
-  for (const Name& regionName : *this) {
-    for (const Delegation& delegation : forwardingHint) {
-      if (delegation.name.isPrefixOf(regionName)) {
-        return true;
-      }
+  for (const Delegation& delegation : forwardingHint) {
+    if (m_prefixes.count(delegation.name) > 0) {
+      return true;
     }
   }
   return false;
@@ -35,11 +35,54 @@ namespace nfd {
  *  This table is used in forwarding to process Interests with Link objects.
  *
  *  NetworkRegionTable exposes a set-like API, including methods `insert`, `clear`,
- *  `find`, `size`, `begin`, and `end`.
+ *  `find`, `size`, `empty`, `begin`, and `end`.
+ *
+ *  In addition to region names, the table keeps a hashed set of every prefix of every
+ *  region name, so that isInProducerRegion costs one hash probe per delegation,
+ *  regardless of how many regions are configured.
  */
-class NetworkRegionTable : public std::set<Name>
+class NetworkRegionTable
 {
 public:
+  typedef std::set<Name>::const_iterator const_iterator;
+  typedef const_iterator iterator;
+
+  std::pair<const_iterator, bool>
+  insert(const Name& region);
+
+  void
+  clear();
+
+  const_iterator
+  find(const Name& region) const
+  {
+    return m_regions.find(region);
+  }
+
+  size_t
+  size() const
+  {
+    return m_regions.size();
+  }
+
+  bool
+  empty() const
+  {
+    return m_regions.empty();
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_regions.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_regions.end();
+  }
+
   /** \brief determines whether an Interest has reached a producer region
    *  \param forwardingHint forwarding hint of an Interest
    *  \retval true the Interest has reached a producer region
@@ -51,6 +94,22 @@ public:
    */
   bool
   isInProducerRegion(const DelegationList& forwardingHint) const;
+
+private:
+  /** \brief hashes a name in the same way as NameTree
+   */
+  class PrefixHash
+  {
+  public:
+    size_t
+    operator()(const Name& prefix) const;
+  };
+
+  std::set<Name> m_regions;
+
+  /** \brief every prefix of every region name
+   */
+  std::unordered_set<Name, PrefixHash> m_prefixes;
 };
 
 } // namespace nfd
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-entry-allocator.hpp"
+
+namespace nfd {
+namespace pit {
+
+constexpr size_t SlabPool::BLOCK_ALIGNMENT;
+
+SlabPool::SlabPool(size_t blockSize, size_t blocksPerSlab)
+  : m_blockSize((std::max(blockSize, sizeof(FreeBlock)) + BLOCK_ALIGNMENT - 1) /
+                BLOCK_ALIGNMENT * BLOCK_ALIGNMENT)
+  , m_blocksPerSlab(blocksPerSlab)
+  , m_freeList(nullptr)
+  , m_nInUse(0)
+{
+  BOOST_ASSERT(blocksPerSlab > 0);
+}
+
+SlabPool::~SlabPool()
+{
+  BOOST_ASSERT(m_nInUse == 0);
+  for (char* slab : m_slabs) {
+    ::operator delete(slab);
+  }
+}
+
+void*
+SlabPool::allocate()
+{
+  if (m_freeList == nullptr) {
+    m_slabs.reserve(m_slabs.size() + 1);
+    // ::operator new returns memory suitably aligned for any fundamental type
+    char* slab = static_cast<char*>(::operator new(m_blockSize * m_blocksPerSlab));
+    m_slabs.push_back(slab);
+    // thread the new blocks onto the free list, so that they are handed out in address order
+    for (size_t i = m_blocksPerSlab; i > 0; --i) {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * m_blockSize);
+      block->next = m_freeList;
+      m_freeList = block;
+    }
+  }
+
+  FreeBlock* block = m_freeList;
+  m_freeList = block->next;
+  ++m_nInUse;
+  return block;
+}
+
+void
+SlabPool::deallocate(void* block)
+{
+  BOOST_ASSERT(block != nullptr);
+  BOOST_ASSERT(m_nInUse > 0);
+  FreeBlock* freed = static_cast<FreeBlock*>(block);
+  freed->next = m_freeList;
+  m_freeList = freed;
+  --m_nInUse;
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_ENTRY_ALLOCATOR_HPP
+#define NFD_DAEMON_TABLE_PIT_ENTRY_ALLOCATOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace pit {
+
+/** \brief a memory pool that hands out blocks of one fixed size
+ *
+ *  Blocks are carved out of large slabs, and freed blocks are kept in a free list for reuse,
+ *  so that allocating and freeing a block is a few pointer operations.
+ *  Slabs are never returned to the system until the pool is destroyed.
+ */
+class SlabPool : noncopyable
+{
+public:
+  /** \param blockSize size of each block; it is rounded up to a multiple of BLOCK_ALIGNMENT
+   *  \param blocksPerSlab number of blocks in each slab
+   */
+  explicit
+  SlabPool(size_t blockSize, size_t blocksPerSlab = 4096);
+
+  ~SlabPool();
+
+  /** \return a block of getBlockSize() octets
+   */
+  void*
+  allocate();
+
+  /** \brief return a block to the pool
+   *  \param block a block previously returned by allocate() of this pool
+   */
+  void
+  deallocate(void* block);
+
+  size_t
+  getBlockSize() const
+  {
+    return m_blockSize;
+  }
+
+  /** \return number of blocks in use
+   */
+  size_t
+  size() const
+  {
+    return m_nInUse;
+  }
+
+  /** \return number of blocks in all slabs
+   */
+  size_t
+  capacity() const
+  {
+    return m_slabs.size() * m_blocksPerSlab;
+  }
+
+public:
+  static constexpr size_t BLOCK_ALIGNMENT = 16;
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  size_t m_blockSize;
+  size_t m_blocksPerSlab;
+  std::vector<char*> m_slabs;
+  FreeBlock* m_freeList;
+  size_t m_nInUse;
+};
+
+/** \brief an allocator for PIT entries that draws memory from a SlabPool
+ *
+ *  When used with allocate_shared, the entry and its shared_ptr control block share one
+ *  pooled block, so that inserting a PIT entry does not call the general-purpose allocator.
+ *  There is one pool for each rebound type.
+ */
+template<typename T>
+class EntryAllocator
+{
+public:
+  typedef T value_type;
+
+  EntryAllocator() = default;
+
+  template<typename U>
+  EntryAllocator(const EntryAllocator<U>&) noexcept
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n != 1) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(getPool().allocate());
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (n != 1) {
+      ::operator delete(p);
+      return;
+    }
+    getPool().deallocate(p);
+  }
+
+  /** \return the pool of this allocator type
+   *  \note The pool is never destroyed, because a shared_ptr may release its entry
+   *        during static destruction.
+   */
+  static SlabPool&
+  getPool()
+  {
+    static_assert(alignof(T) <= SlabPool::BLOCK_ALIGNMENT, "T is over-aligned");
+    static SlabPool* pool = new SlabPool(sizeof(T));
+    return *pool;
+  }
+};
+
+template<typename T, typename U>
+bool
+operator==(const EntryAllocator<T>&, const EntryAllocator<U>&) noexcept
+{
+  return true;
+}
+
+template<typename T, typename U>
+bool
+operator!=(const EntryAllocator<T>&, const EntryAllocator<U>&) noexcept
+{
+  return false;
+}
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_ENTRY_ALLOCATOR_HPP
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-entry-handle.hpp"
+
+namespace nfd {
+namespace pit {
+
+constexpr uint32_t EntryHandle::INVALID_INDEX;
+
+HandleTable::HandleTable()
+  : m_freeHead(EntryHandle::INVALID_INDEX)
+  , m_nInUse(0)
+{
+}
+
+EntryHandle
+HandleTable::add(Entry& entry)
+{
+  uint32_t index = m_freeHead;
+  if (index == EntryHandle::INVALID_INDEX) {
+    BOOST_ASSERT(m_slots.size() < EntryHandle::INVALID_INDEX);
+    index = static_cast<uint32_t>(m_slots.size());
+    m_slots.push_back({nullptr, 0, EntryHandle::INVALID_INDEX});
+  }
+  else {
+    m_freeHead = m_slots[index].nextFree;
+  }
+
+  Slot& slot = m_slots[index];
+  slot.entry = &entry;
+  ++m_nInUse;
+
+  EntryHandle handle;
+  handle.m_index = index;
+  handle.m_generation = slot.generation;
+  return handle;
+}
+
+void
+HandleTable::remove(const EntryHandle& handle)
+{
+  BOOST_ASSERT(this->get(handle) != nullptr);
+
+  Slot& slot = m_slots[handle.m_index];
+  slot.entry = nullptr;
+  ++slot.generation;
+  slot.nextFree = m_freeHead;
+  m_freeHead = handle.m_index;
+  --m_nInUse;
+}
+
+Entry*
+HandleTable::get(const EntryHandle& handle) const
+{
+  if (handle.m_index >= m_slots.size()) {
+    return nullptr;
+  }
+
+  const Slot& slot = m_slots[handle.m_index];
+  if (slot.generation != handle.m_generation) {
+    return nullptr;
+  }
+  return slot.entry;
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_ENTRY_HANDLE_HPP
+#define NFD_DAEMON_TABLE_PIT_ENTRY_HANDLE_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace pit {
+
+class Entry;
+class HandleTable;
+
+/** \brief a generation-checked, non-owning reference to a PIT entry
+ *
+ *  Unlike weak_ptr<Entry>, a handle is a pair of integers: copying it does not touch any
+ *  reference count. It is resolved through Pit::get, which returns nullptr once the entry
+ *  has been erased from the PIT, even if the entry is still kept alive by a shared_ptr.
+ */
+class EntryHandle
+{
+public:
+  /** \brief construct a handle that refers to no entry
+   */
+  EntryHandle()
+    : m_index(INVALID_INDEX)
+    , m_generation(0)
+  {
+  }
+
+  friend bool
+  operator==(const EntryHandle& lhs, const EntryHandle& rhs)
+  {
+    return lhs.m_index == rhs.m_index && lhs.m_generation == rhs.m_generation;
+  }
+
+  friend bool
+  operator!=(const EntryHandle& lhs, const EntryHandle& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+  uint32_t m_index;
+  uint32_t m_generation;
+
+  friend class HandleTable;
+};
+
+/** \brief a table of slots that maps EntryHandles to PIT entries
+ *
+ *  Each live entry occupies one slot. When the entry is removed, the generation of its slot is
+ *  incremented, so that existing handles of the entry no longer resolve, and the slot is put
+ *  on a free list for reuse.
+ */
+class HandleTable : noncopyable
+{
+public:
+  HandleTable();
+
+  /** \brief assign a slot to \p entry
+   *  \return a handle that resolves to \p entry until remove is called
+   */
+  EntryHandle
+  add(Entry& entry);
+
+  /** \brief release the slot of \p handle, invalidating all copies of \p handle
+   *  \pre \p handle has been returned by add, and has not been removed
+   */
+  void
+  remove(const EntryHandle& handle);
+
+  /** \return the entry referred to by \p handle, or nullptr if it has been removed
+   */
+  Entry*
+  get(const EntryHandle& handle) const;
+
+  /** \return number of entries in the table
+   */
+  size_t
+  size() const
+  {
+    return m_nInUse;
+  }
+
+private:
+  struct Slot
+  {
+    Entry* entry;
+    uint32_t generation;
+    /// index of the next free slot; meaningful only if entry is nullptr
+    uint32_t nextFree;
+  };
+
+  std::vector<Slot> m_slots;
+  uint32_t m_freeHead;
+  size_t m_nInUse;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_ENTRY_HANDLE_HPP
@@ -30,8 +30,12 @@ namespace nfd {
 namespace pit {
 
 Entry::Entry(const Interest& interest)
-  : m_interest(interest.shared_from_this())
+  : m_isStraggler(false)
+  , m_isSatisfied(false)
+  , m_interest(interest.shared_from_this())
+  , m_creationTime(time::steady_clock::now())
   , m_nameTreeEntry(nullptr)
+  , m_faceIndex(nullptr)
 {
 }
 
@@ -62,8 +66,10 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
   auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
     [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
   if (it == m_inRecords.end()) {
-    m_inRecords.emplace_front(face);
-    it = m_inRecords.begin();
+    it = m_inRecords.emplace(m_inRecords.begin(), face);
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->insert(*it, *this);
+    }
   }
 
   it->update(interest);
@@ -101,8 +107,10 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
   auto it = std::find_if(m_outRecords.begin(), m_outRecords.end(),
     [&face] (const OutRecord& outRecord) { return &outRecord.getFace() == &face; });
   if (it == m_outRecords.end()) {
-    m_outRecords.emplace_front(face);
-    it = m_outRecords.begin();
+    it = m_outRecords.emplace(m_outRecords.begin(), face);
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->insert(*it, *this);
+    }
   }
 
   it->update(interest);
@@ -26,9 +26,15 @@
 #ifndef NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 #define NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 
+#include "pit-entry-handle.hpp"
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
-#include "core/scheduler.hpp"
+#include "pit-timer-wheel.hpp"
+
+#include <boost/version.hpp>
+#if BOOST_VERSION >= 105800
+#include <boost/container/small_vector.hpp>
+#endif // BOOST_VERSION >= 105800
 
 namespace nfd {
 
@@ -38,23 +44,37 @@ class Entry;
 
 namespace pit {
 
+class Pit;
+
+#if BOOST_VERSION >= 105800
 /** \brief an unordered collection of in-records
+ *
+ *  The first few records are stored inline in the PIT entry.
  */
-typedef std::list<InRecord> InRecordCollection;
+typedef boost::container::small_vector<InRecord, 2> InRecordCollection;
 
 /** \brief an unordered collection of out-records
+ *
+ *  The first few records are stored inline in the PIT entry.
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef boost::container::small_vector<OutRecord, 2> OutRecordCollection;
+#else
+typedef std::vector<InRecord> InRecordCollection;
+typedef std::vector<OutRecord> OutRecordCollection;
+#endif // BOOST_VERSION >= 105800
 
 /** \brief an Interest table entry
  *
  *  An Interest table entry represents either a pending Interest or a recently satisfied Interest.
  *  Each entry contains a collection of in-records, a collection of out-records,
- *  and two timers used in forwarding pipelines.
+ *  and an expiry timer used in forwarding pipelines.
  *  In addition, the entry, in-records, and out-records are subclasses of StrategyInfoHost,
  *  which allows forwarding strategy to store arbitrary information on them.
+ *
+ *  \warning Inserting or deleting an in-record (out-record) invalidates iterators and references
+ *           to other in-records (out-records) of the same entry.
  */
-class Entry : public StrategyInfoHost, noncopyable
+class Entry : public StrategyInfoHost, public enable_shared_from_this<Entry>, noncopyable
 {
 public:
   explicit
@@ -79,6 +99,24 @@ public:
     return m_interest->getName();
   }
 
+  /** \return when this entry was created
+   */
+  time::steady_clock::TimePoint
+  getCreationTime() const
+  {
+    return m_creationTime;
+  }
+
+  /** \return a handle that resolves to this entry through Pit::get while it is in the PIT
+   *
+   *  The returned handle refers to no entry if this entry is not part of a PIT.
+   */
+  const EntryHandle&
+  getHandle() const
+  {
+    return m_handle;
+  }
+
   /** \return whether interest matches this entry
    *  \param interest the Interest
    *  \param nEqualNameComps number of initial name components guaranteed to be equal
@@ -215,35 +253,52 @@ public: // out-record
   deleteOutRecord(const Face& face);
 
 public:
-  /** \brief unsatisfy timer
+  /** \brief expiry timer
    *
-   *  This timer is used in forwarding pipelines to delete the entry
-   *  when it expires without being satisfied.
-   *  It fires when the last InterestLifetime among in-records expires.
+   *  This timer is used in forwarding pipelines to delete the entry. It is armed either as
+   *  the unsatisfy timer, which fires when the last InterestLifetime among in-records expires
+   *  without the entry being satisfied, or as the straggler timer, which fires when the entry
+   *  has been satisfied or rejected and is no longer needed for measurement collection purpose.
    *
-   *  Either this or the straggler timer should be set at all times,
-   *  except when this entry is being processed in a pipeline.
+   *  This timer should be armed at all times, except when this entry is being processed
+   *  in a pipeline.
    */
-  scheduler::EventId m_unsatisfyTimer;
+  TimerWheelHook m_expiryTimer;
 
-  /** \brief straggler timer
+  /** \brief whether the expiry timer is armed as the straggler timer
+   */
+  bool m_isStraggler;
+
+  /** \brief whether the entry has been satisfied
    *
-   *  This timer is used in forwarding pipelines to delete the entry when it has been satisfied
-   *  and is no longer needed for measurement collection purpose.
+   *  This is meaningful only if the expiry timer is armed as the straggler timer.
+   */
+  bool m_isSatisfied;
+
+  /** \brief FreshnessPeriod of the Data that satisfied the entry
    *
-   *  Either this or the unsatisfy timer should be set at all times,
-   *  except when this entry is being processed in a pipeline.
+   *  This is meaningful only if the expiry timer is armed as the straggler timer.
    */
-  scheduler::EventId m_stragglerTimer;
+  ndn::optional<time::milliseconds> m_dataFreshnessPeriod;
 
 private:
   shared_ptr<const Interest> m_interest;
+  time::steady_clock::TimePoint m_creationTime;
   InRecordCollection m_inRecords;
   OutRecordCollection m_outRecords;
 
   name_tree::Entry* m_nameTreeEntry;
 
+  /** \brief the face index of the PIT this entry belongs to
+   *
+   *  This is nullptr if the entry is not part of a PIT, or has been erased from the PIT.
+   */
+  FaceRecordIndex* m_faceIndex;
+
+  EntryHandle m_handle;
+
   friend class name_tree::Entry;
+  friend class Pit;
 };
 
 } // namespace pit
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-face-index.hpp"
+#include "pit-face-record.hpp"
+
+namespace nfd {
+namespace pit {
+
+void
+FaceRecordIndexHook::linkBefore(FaceRecordIndexHook& pos)
+{
+  BOOST_ASSERT(!this->isLinked());
+  BOOST_ASSERT(pos.isLinked());
+
+  m_prev = pos.m_prev;
+  m_next = &pos;
+  m_prev->m_next = this;
+  pos.m_prev = this;
+}
+
+void
+FaceRecordIndexHook::unlink() noexcept
+{
+  if (!this->isLinked()) {
+    return;
+  }
+
+  m_prev->m_next = m_next;
+  m_next->m_prev = m_prev;
+  m_prev = m_next = nullptr;
+}
+
+void
+FaceRecordIndexHook::takePosition(FaceRecordIndexHook& other) noexcept
+{
+  BOOST_ASSERT(!this->isLinked());
+
+  m_entry = other.m_entry;
+  if (!other.isLinked()) {
+    return;
+  }
+
+  m_prev = other.m_prev;
+  m_next = other.m_next;
+  m_prev->m_next = this;
+  m_next->m_prev = this;
+  other.m_prev = other.m_next = nullptr;
+}
+
+FaceRecordIndex::~FaceRecordIndex()
+{
+  // records may outlive the index, so they must not point to the sentinels
+  for (auto& p : m_lists) {
+    FaceRecordIndexHook& head = p.second;
+    while (head.isLinked() && head.m_next != &head) {
+      head.m_next->unlink();
+    }
+    head.unlink();
+  }
+}
+
+void
+FaceRecordIndex::insert(FaceRecord& record, Entry& entry)
+{
+  FaceRecordIndexHook& head = m_lists[&record.getFace()];
+  if (!head.isLinked()) {
+    head.m_prev = head.m_next = &head;
+  }
+
+  FaceRecordIndexHook& node = record;
+  node.m_entry = &entry;
+  node.linkBefore(head);
+}
+
+void
+FaceRecordIndex::erase(FaceRecord& record)
+{
+  static_cast<FaceRecordIndexHook&>(record).unlink();
+}
+
+void
+FaceRecordIndex::eraseIfEmpty(const Face& face)
+{
+  auto it = m_lists.find(&face);
+  if (it != m_lists.end() && it->second.m_next == &it->second) {
+    m_lists.erase(it);
+  }
+}
+
+size_t
+FaceRecordIndex::count(const Face& face) const
+{
+  auto it = m_lists.find(&face);
+  if (it == m_lists.end()) {
+    return 0;
+  }
+
+  size_t n = 0;
+  const FaceRecordIndexHook& head = it->second;
+  for (const FaceRecordIndexHook* node = head.m_next; node != &head; node = node->m_next) {
+    ++n;
+  }
+  return n;
+}
+
+std::vector<Entry*>
+FaceRecordIndex::findEntries(const Face& face) const
+{
+  std::vector<Entry*> entries;
+  auto it = m_lists.find(&face);
+  if (it == m_lists.end()) {
+    return entries;
+  }
+
+  const FaceRecordIndexHook& head = it->second;
+  for (const FaceRecordIndexHook* node = head.m_next; node != &head; node = node->m_next) {
+    entries.push_back(node->m_entry);
+  }
+
+  // an entry with both in-record and out-record of the face appears twice
+  std::sort(entries.begin(), entries.end());
+  entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+  return entries;
+}
+
+} // namespace pit
+} // namespace nfd
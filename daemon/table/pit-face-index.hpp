@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_FACE_INDEX_HPP
+#define NFD_DAEMON_TABLE_PIT_FACE_INDEX_HPP
+
+#include "core/common.hpp"
+#include "face/face.hpp"
+
+namespace nfd {
+namespace pit {
+
+class Entry;
+class FaceRecord;
+class FaceRecordIndex;
+
+/** \brief a node in the per-face list of PIT in-records and out-records
+ *
+ *  FaceRecord inherits from this class. Records of the same face are linked into a circular
+ *  doubly linked list owned by FaceRecordIndex. The links are stored in the record itself,
+ *  so that linking and unlinking never allocate memory. Moving a record (e.g. when the
+ *  record collection grows) moves its position in the list; destroying a record unlinks it.
+ */
+class FaceRecordIndexHook
+{
+public:
+  FaceRecordIndexHook()
+    : m_prev(nullptr)
+    , m_next(nullptr)
+    , m_entry(nullptr)
+  {
+  }
+
+  FaceRecordIndexHook(const FaceRecordIndexHook&) = delete;
+
+  FaceRecordIndexHook(FaceRecordIndexHook&& other) noexcept
+    : FaceRecordIndexHook()
+  {
+    this->takePosition(other);
+  }
+
+  FaceRecordIndexHook&
+  operator=(const FaceRecordIndexHook&) = delete;
+
+  FaceRecordIndexHook&
+  operator=(FaceRecordIndexHook&& other) noexcept
+  {
+    if (this != &other) {
+      this->unlink();
+      this->takePosition(other);
+    }
+    return *this;
+  }
+
+  ~FaceRecordIndexHook()
+  {
+    this->unlink();
+  }
+
+  /** \return whether this record is linked into a FaceRecordIndex
+   */
+  bool
+  isLinked() const
+  {
+    return m_next != nullptr;
+  }
+
+private:
+  /** \brief insert this node before \p pos
+   *  \pre !isLinked()
+   */
+  void
+  linkBefore(FaceRecordIndexHook& pos);
+
+  /** \brief remove this node from its list, if any
+   */
+  void
+  unlink() noexcept;
+
+  /** \brief put this node in place of \p other, leaving \p other unlinked
+   *  \pre !isLinked()
+   */
+  void
+  takePosition(FaceRecordIndexHook& other) noexcept;
+
+private:
+  FaceRecordIndexHook* m_prev;
+  FaceRecordIndexHook* m_next;
+  Entry* m_entry;
+
+  friend class FaceRecordIndex;
+};
+
+/** \brief an index of PIT in-records and out-records by face
+ *
+ *  Pit keeps an index of this type, so that entries referring to a face can be found in time
+ *  proportional to the number of records of that face, without enumerating the NameTree.
+ */
+class FaceRecordIndex : noncopyable
+{
+public:
+  ~FaceRecordIndex();
+
+  /** \brief link \p record, which belongs to \p entry, into the list of its face
+   *  \pre \p record is not linked
+   */
+  void
+  insert(FaceRecord& record, Entry& entry);
+
+  /** \brief unlink \p record from the list of its face
+   */
+  void
+  erase(FaceRecord& record);
+
+  /** \brief forget \p face if it has no records left
+   */
+  void
+  eraseIfEmpty(const Face& face);
+
+  /** \return number of faces that have a list, including faces whose list is empty
+   */
+  size_t
+  size() const
+  {
+    return m_lists.size();
+  }
+
+  /** \return number of in-records and out-records of \p face
+   */
+  size_t
+  count(const Face& face) const;
+
+  /** \return PIT entries that have an in-record or out-record of \p face
+   *  \note The returned collection is a snapshot, which is not invalidated when entries
+   *        are modified or erased afterwards. Each entry appears at most once.
+   */
+  std::vector<Entry*>
+  findEntries(const Face& face) const;
+
+private:
+  /** \brief sentinel nodes of per-face lists
+   *
+   *  A sentinel node is unlinked when default-constructed, and becomes a self loop
+   *  when the first record of its face is inserted.
+   */
+  std::unordered_map<const Face*, FaceRecordIndexHook> m_lists;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_FACE_INDEX_HPP
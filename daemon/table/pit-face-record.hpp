@@ -26,7 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_PIT_FACE_RECORD_HPP
 #define NFD_DAEMON_TABLE_PIT_FACE_RECORD_HPP
 
-#include "face/face.hpp"
+#include "pit-face-index.hpp"
 #include "strategy-info-host.hpp"
 
 namespace nfd {
@@ -37,7 +37,7 @@ namespace pit {
  *  \note This is an implementation detail to extract common functionality
  *        of InRecord and OutRecord
  */
-class FaceRecord : public StrategyInfoHost
+class FaceRecord : public StrategyInfoHost, public FaceRecordIndexHook
 {
 public:
   explicit
@@ -64,7 +64,7 @@ public:
   update(const Interest& interest);
 
 private:
-  Face& m_face;
+  Face* m_face;
   uint32_t m_lastNonce;
   time::steady_clock::TimePoint m_lastRenewed;
   time::steady_clock::TimePoint m_expiry;
@@ -73,7 +73,7 @@ private:
 inline Face&
 FaceRecord::getFace() const
 {
-  return m_face;
+  return *m_face;
 }
 
 inline uint32_t
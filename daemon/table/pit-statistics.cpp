@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-statistics.hpp"
+
+namespace nfd {
+namespace pit {
+
+const size_t Statistics::N_RESIDENCY_BUCKETS;
+const size_t Statistics::MAX_PREFIX_RECORDS = 1024;
+
+Statistics::Statistics()
+  : m_prefixLength(0)
+  , m_nStragglerExpirations(0)
+{
+  m_satisfiedResidency.fill(0);
+  m_unsatisfiedResidency.fill(0);
+}
+
+void
+Statistics::setPrefixLength(size_t prefixLength)
+{
+  if (prefixLength != m_prefixLength) {
+    m_prefixRecords.clear();
+  }
+  m_prefixLength = prefixLength;
+}
+
+void
+Statistics::recordInsert(const Name& name, bool isNew, bool isStraggler)
+{
+  Record* prefixRecord = nullptr;
+  if (m_prefixLength > 0) {
+    Name prefix = name.getPrefix(std::min(m_prefixLength, name.size()));
+    auto it = m_prefixRecords.find(prefix);
+    if (it != m_prefixRecords.end()) {
+      prefixRecord = &it->second;
+    }
+    else if (m_prefixRecords.size() < MAX_PREFIX_RECORDS) {
+      prefixRecord = &m_prefixRecords[prefix];
+    }
+  }
+
+  for (Record* record : {&m_total, prefixRecord}) {
+    if (record == nullptr) {
+      continue;
+    }
+    ++record->nInterests;
+    if (!isNew) {
+      ++record->nAggregated;
+      if (isStraggler) {
+        ++record->nStragglerHits;
+      }
+    }
+  }
+}
+
+void
+Statistics::recordErase(time::nanoseconds residency, bool isStraggler, bool isSatisfied)
+{
+  if (isStraggler) {
+    ++m_nStragglerExpirations;
+  }
+
+  size_t bucket = getResidencyBucket(residency);
+  if (isStraggler && isSatisfied) {
+    ++m_satisfiedResidency[bucket];
+  }
+  else {
+    ++m_unsatisfiedResidency[bucket];
+  }
+}
+
+size_t
+Statistics::getResidencyBucket(time::nanoseconds residency)
+{
+  auto ms = time::duration_cast<time::milliseconds>(residency).count();
+  size_t bucket = 0;
+  while (ms > 0 && bucket < N_RESIDENCY_BUCKETS - 1) {
+    ms >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+} // namespace pit
+} // namespace nfd
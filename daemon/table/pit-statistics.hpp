@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_STATISTICS_HPP
+#define NFD_DAEMON_TABLE_PIT_STATISTICS_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+#include <map>
+
+namespace nfd {
+namespace pit {
+
+/** \brief aggregation and residency statistics of the PIT
+ *
+ *  Aggregation counters are kept for all Interests, and optionally per name prefix formed by
+ *  a fixed number of leading name components. Residency histograms record how long erased
+ *  entries stayed in the PIT, including the straggler period.
+ */
+class Statistics : noncopyable
+{
+public:
+  /** \brief aggregation counters of Interests under a name prefix
+   */
+  struct Record
+  {
+    /** \brief count of Interests inserted into the PIT
+     */
+    uint64_t nInterests = 0;
+
+    /** \brief count of Interests that found an existing PIT entry
+     */
+    uint64_t nAggregated = 0;
+
+    /** \brief count of Interests that found a PIT entry kept alive by the straggler timer
+     */
+    uint64_t nStragglerHits = 0;
+  };
+
+  /** \brief number of buckets in a residency histogram
+   *
+   *  Bucket 0 counts entries that stayed less than 1ms. Bucket i counts entries that stayed
+   *  at least 2^(i-1)ms and less than 2^i ms, except for the last bucket, which has no upper bound.
+   */
+  static const size_t N_RESIDENCY_BUCKETS = 18;
+
+  using ResidencyHistogram = std::array<uint64_t, N_RESIDENCY_BUCKETS>;
+
+  /** \brief maximum number of name prefixes with their own Record
+   *
+   *  Interests under further prefixes are only counted in the total.
+   */
+  static const size_t MAX_PREFIX_RECORDS;
+
+  Statistics();
+
+  /** \return number of leading name components that identify a prefix in per-prefix records
+   *  \retval 0 per-prefix records are disabled
+   */
+  size_t
+  getPrefixLength() const
+  {
+    return m_prefixLength;
+  }
+
+  /** \brief set number of leading name components that identify a prefix in per-prefix records
+   *  \param prefixLength zero disables per-prefix records
+   *
+   *  Changing the prefix length clears existing per-prefix records.
+   */
+  void
+  setPrefixLength(size_t prefixLength);
+
+  /** \return aggregation counters of all Interests
+   */
+  const Record&
+  getTotal() const
+  {
+    return m_total;
+  }
+
+  /** \return aggregation counters per name prefix
+   */
+  const std::map<Name, Record>&
+  getPrefixRecords() const
+  {
+    return m_prefixRecords;
+  }
+
+  /** \return count of entries erased after entering the straggler period
+   */
+  uint64_t
+  getNStragglerExpirations() const
+  {
+    return m_nStragglerExpirations;
+  }
+
+  /** \return residency histogram of entries that were satisfied by Data
+   */
+  const ResidencyHistogram&
+  getSatisfiedResidency() const
+  {
+    return m_satisfiedResidency;
+  }
+
+  /** \return residency histogram of entries that were not satisfied
+   */
+  const ResidencyHistogram&
+  getUnsatisfiedResidency() const
+  {
+    return m_unsatisfiedResidency;
+  }
+
+  /** \brief record an Interest inserted into the PIT
+   *  \param name the Interest name
+   *  \param isNew whether a new entry has been created for the Interest
+   *  \param isStraggler whether the existing entry was kept alive by the straggler timer
+   */
+  void
+  recordInsert(const Name& name, bool isNew, bool isStraggler);
+
+  /** \brief record a PIT entry being erased
+   *  \param residency how long the entry stayed in the PIT
+   *  \param isStraggler whether the entry was erased after its straggler period
+   *  \param isSatisfied whether the entry was satisfied by Data
+   */
+  void
+  recordErase(time::nanoseconds residency, bool isStraggler, bool isSatisfied);
+
+  /** \return index of the residency histogram bucket for \p residency
+   */
+  static size_t
+  getResidencyBucket(time::nanoseconds residency);
+
+private:
+  size_t m_prefixLength;
+  Record m_total;
+  std::map<Name, Record> m_prefixRecords;
+  uint64_t m_nStragglerExpirations;
+  ResidencyHistogram m_satisfiedResidency;
+  ResidencyHistogram m_unsatisfiedResidency;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_STATISTICS_HPP
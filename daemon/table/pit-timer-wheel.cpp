@@ -0,0 +1,300 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-timer-wheel.hpp"
+#include "pit-entry.hpp"
+
+namespace nfd {
+namespace pit {
+
+constexpr size_t TimerWheel::N_LEVELS;
+constexpr size_t TimerWheel::SLOT_BITS;
+constexpr size_t TimerWheel::N_SLOTS;
+
+TimerWheelHook::TimerWheelHook()
+  : m_prev(nullptr)
+  , m_next(nullptr)
+  , m_wheel(nullptr)
+  , m_entry(nullptr)
+  , m_tick(0)
+{
+}
+
+TimerWheelHook::~TimerWheelHook()
+{
+  if (this->isArmed() && m_wheel != nullptr) {
+    --m_wheel->m_size;
+  }
+  this->unlink();
+}
+
+void
+TimerWheelHook::linkBefore(TimerWheelHook& pos)
+{
+  BOOST_ASSERT(!this->isArmed());
+  m_prev = pos.m_prev;
+  m_next = &pos;
+  m_prev->m_next = this;
+  pos.m_prev = this;
+}
+
+void
+TimerWheelHook::unlink()
+{
+  if (m_next == nullptr) {
+    return;
+  }
+  m_prev->m_next = m_next;
+  m_next->m_prev = m_prev;
+  m_prev = m_next = nullptr;
+}
+
+void
+TimerWheelHook::takeList(TimerWheelHook& sentinel)
+{
+  BOOST_ASSERT(!this->isArmed());
+  BOOST_ASSERT(sentinel.m_next != &sentinel);
+  m_next = sentinel.m_next;
+  m_prev = sentinel.m_prev;
+  m_next->m_prev = this;
+  m_prev->m_next = this;
+  sentinel.makeSentinel();
+}
+
+TimerWheel::TimerWheel(const ExpireCallback& expireCallback, time::nanoseconds tickDuration)
+  : m_expireCallback(expireCallback)
+  , m_tickDuration(tickDuration)
+  , m_origin(time::steady_clock::now())
+  , m_currentTick(0)
+  , m_size(0)
+  , m_wakeupTick(0)
+  , m_hasWakeup(false)
+{
+  BOOST_ASSERT(tickDuration > time::nanoseconds::zero());
+  for (auto& level : m_slots) {
+    for (TimerWheelHook& sentinel : level) {
+      sentinel.makeSentinel();
+    }
+  }
+}
+
+TimerWheel::~TimerWheel()
+{
+  // unlink all timers, so that entries outliving the wheel do not point to freed sentinels
+  for (auto& level : m_slots) {
+    for (TimerWheelHook& sentinel : level) {
+      while (sentinel.m_next != &sentinel) {
+        sentinel.m_next->m_wheel = nullptr;
+        sentinel.m_next->unlink();
+      }
+      sentinel.unlink();
+    }
+  }
+}
+
+uint64_t
+TimerWheel::toTick(const time::steady_clock::TimePoint& t) const
+{
+  if (t <= m_origin) {
+    return 0;
+  }
+  return static_cast<uint64_t>((t - m_origin) / m_tickDuration);
+}
+
+time::steady_clock::TimePoint
+TimerWheel::toTimePoint(uint64_t tick) const
+{
+  return m_origin + m_tickDuration * static_cast<time::nanoseconds::rep>(tick);
+}
+
+void
+TimerWheel::arm(Entry& entry, const time::steady_clock::TimePoint& expiry)
+{
+  TimerWheelHook& timer = entry.m_expiryTimer;
+  if (timer.isArmed()) {
+    timer.unlink();
+    --m_size;
+  }
+
+  if (m_size == 0 && !m_hasWakeup) {
+    // the wheel is idle: skip the elapsed ticks instead of processing them one by one
+    m_currentTick = std::max(m_currentTick, this->toTick(time::steady_clock::now()));
+  }
+
+  // round up, so that the timer never fires before its expiry time
+  uint64_t tick = this->toTick(expiry);
+  if (this->toTimePoint(tick) < expiry) {
+    ++tick;
+  }
+
+  timer.m_wheel = this;
+  timer.m_entry = &entry;
+  timer.m_tick = std::max(tick, m_currentTick + 1);
+  this->place(timer);
+  ++m_size;
+
+  // wake up no later than the next level-0 rotation, so that higher levels are cascaded on time
+  uint64_t nextRotation = (m_currentTick | (N_SLOTS - 1)) + 1;
+  this->scheduleWakeup(std::min(timer.m_tick, nextRotation));
+}
+
+void
+TimerWheel::cancel(Entry& entry)
+{
+  TimerWheelHook& timer = entry.m_expiryTimer;
+  if (!timer.isArmed()) {
+    return;
+  }
+  timer.unlink();
+  --m_size;
+  // the wakeup event is left in place; a spurious wakeup finds nothing to expire
+}
+
+void
+TimerWheel::place(TimerWheelHook& timer)
+{
+  BOOST_ASSERT(timer.m_tick >= m_currentTick);
+  uint64_t delta = timer.m_tick - m_currentTick;
+
+  size_t level = 0;
+  while (level < N_LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+
+  // a timer beyond the top level is parked at its furthest slot, and re-placed on cascade
+  uint64_t tick = std::min(timer.m_tick,
+                           m_currentTick + (uint64_t(1) << (SLOT_BITS * N_LEVELS)) - 1);
+  size_t slot = (tick >> (SLOT_BITS * level)) & (N_SLOTS - 1);
+  timer.linkBefore(m_slots[level][slot]);
+}
+
+void
+TimerWheel::advance()
+{
+  m_hasWakeup = false;
+  uint64_t nowTick = this->toTick(time::steady_clock::now());
+
+  while (m_currentTick < nowTick && m_size > 0) {
+    ++m_currentTick;
+
+    // find the highest level whose slot boundary has been reached
+    size_t topLevel = 0;
+    while (topLevel < N_LEVELS - 1 &&
+           (m_currentTick & ((uint64_t(1) << (SLOT_BITS * (topLevel + 1))) - 1)) == 0) {
+      ++topLevel;
+    }
+    // cascade from the top, because a higher level may refill the current slot of a lower level
+    for (size_t level = topLevel; level > 0; --level) {
+      this->cascade(level, (m_currentTick >> (SLOT_BITS * level)) & (N_SLOTS - 1));
+    }
+
+    this->expireCurrentSlot();
+  }
+  m_currentTick = std::max(m_currentTick, nowTick);
+
+  this->scheduleNextWakeup();
+}
+
+void
+TimerWheel::cascade(size_t level, size_t slot)
+{
+  TimerWheelHook& sentinel = m_slots[level][slot];
+  if (sentinel.m_next == &sentinel) {
+    return;
+  }
+
+  // detach the list first, because timers may be re-placed into the same slot
+  TimerWheelHook pending;
+  pending.takeList(sentinel);
+
+  while (pending.m_next != &pending) {
+    TimerWheelHook& timer = *pending.m_next;
+    timer.unlink();
+    this->place(timer);
+  }
+  pending.unlink();
+}
+
+void
+TimerWheel::expireCurrentSlot()
+{
+  TimerWheelHook& sentinel = m_slots[0][m_currentTick & (N_SLOTS - 1)];
+  if (sentinel.m_next == &sentinel) {
+    return;
+  }
+
+  // detach the batch first, so that callbacks may safely arm and cancel any timer
+  TimerWheelHook batch;
+  batch.takeList(sentinel);
+
+  while (batch.m_next != &batch) {
+    TimerWheelHook& timer = *batch.m_next;
+    BOOST_ASSERT(timer.m_tick == m_currentTick);
+    timer.unlink();
+    --m_size;
+    m_expireCallback(*timer.m_entry);
+  }
+  batch.unlink();
+}
+
+void
+TimerWheel::scheduleWakeup(uint64_t tick)
+{
+  if (m_hasWakeup && m_wakeupTick <= tick) {
+    return;
+  }
+
+  time::nanoseconds delay = std::max(time::nanoseconds::zero(),
+                                     time::duration_cast<time::nanoseconds>(
+                                       this->toTimePoint(tick) - time::steady_clock::now()));
+  m_wakeupEvent = scheduler::schedule(delay, bind(&TimerWheel::advance, this));
+  m_wakeupTick = tick;
+  m_hasWakeup = true;
+}
+
+void
+TimerWheel::scheduleNextWakeup()
+{
+  if (m_size == 0) {
+    // a callback may have armed and then cancelled a timer, which scheduled a wakeup
+    m_wakeupEvent.cancel();
+    m_hasWakeup = false;
+    return;
+  }
+
+  uint64_t nextRotation = (m_currentTick | (N_SLOTS - 1)) + 1;
+  uint64_t next = nextRotation;
+  for (uint64_t tick = m_currentTick + 1; tick < nextRotation; ++tick) {
+    const TimerWheelHook& sentinel = m_slots[0][tick & (N_SLOTS - 1)];
+    if (sentinel.m_next != &sentinel) {
+      next = tick;
+      break;
+    }
+  }
+  this->scheduleWakeup(next);
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_TIMER_WHEEL_HPP
+#define NFD_DAEMON_TABLE_PIT_TIMER_WHEEL_HPP
+
+#include "core/scheduler.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace pit {
+
+class Entry;
+class TimerWheel;
+
+/** \brief a PIT entry timer that can be armed on a TimerWheel
+ *
+ *  The timer is a node in an intrusive doubly linked list of its wheel slot,
+ *  so that arming and cancelling it never allocates memory.
+ *  A timer is cancelled when it is destroyed.
+ */
+class TimerWheelHook : noncopyable
+{
+public:
+  TimerWheelHook();
+
+  ~TimerWheelHook();
+
+  /** \return whether the timer is armed
+   */
+  bool
+  isArmed() const
+  {
+    return m_next != nullptr;
+  }
+
+private:
+  /** \brief insert this node before \p pos
+   *  \pre !isArmed()
+   */
+  void
+  linkBefore(TimerWheelHook& pos);
+
+  /** \brief remove this node from its list, if any
+   */
+  void
+  unlink();
+
+  /** \brief make this node the sentinel of an empty list
+   */
+  void
+  makeSentinel()
+  {
+    m_prev = m_next = this;
+  }
+
+  /** \brief move all nodes of the list headed by \p sentinel into the list headed by this node
+   *  \pre !isArmed(), and the list headed by \p sentinel is not empty
+   *  \post this node is the sentinel of the moved list, and \p sentinel heads an empty list
+   */
+  void
+  takeList(TimerWheelHook& sentinel);
+
+private:
+  TimerWheelHook* m_prev;
+  TimerWheelHook* m_next;
+  TimerWheel* m_wheel;
+  Entry* m_entry;
+  uint64_t m_tick;
+
+  friend class TimerWheel;
+};
+
+/** \brief a hierarchical timing wheel for PIT entry expiry
+ *
+ *  Each PIT entry has one expiry timer (pit::Entry::m_expiryTimer). Arming and cancelling
+ *  a timer take constant time. Expiry is processed in batches: the wheel is driven by a single
+ *  event in the global scheduler, and all timers due at the same tick are expired together.
+ *
+ *  Time is divided into ticks. A timer fires at the first tick that is not earlier than its
+ *  expiry time, so it may fire up to one tick late, but never early.
+ *  The wheel has four levels of 256 slots each; with the default 1ms tick, timers up to
+ *  about 49 days into the future are placed directly, and longer timers are re-placed
+ *  when the top level rotates.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  /** \brief a callback invoked when the expiry timer of a PIT entry fires
+   *  \note The timer is no longer armed when the callback is invoked.
+   */
+  typedef function<void(Entry& entry)> ExpireCallback;
+
+  explicit
+  TimerWheel(const ExpireCallback& expireCallback,
+             time::nanoseconds tickDuration = time::milliseconds(1));
+
+  /** \brief cancels all timers
+   */
+  ~TimerWheel();
+
+  /** \return number of armed timers
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \brief arm the expiry timer of \p entry
+   *
+   *  If the timer is already armed, it is re-armed with the new expiry time.
+   *  If \p expiry has already passed, the timer fires at the next tick.
+   */
+  void
+  arm(Entry& entry, const time::steady_clock::TimePoint& expiry);
+
+  /** \brief cancel the expiry timer of \p entry
+   *
+   *  If the timer is not armed, this is a no-op.
+   */
+  void
+  cancel(Entry& entry);
+
+private:
+  /** \return number of whole ticks between the origin and \p t
+   */
+  uint64_t
+  toTick(const time::steady_clock::TimePoint& t) const;
+
+  /** \return the starting time of \p tick
+   */
+  time::steady_clock::TimePoint
+  toTimePoint(uint64_t tick) const;
+
+  /** \brief place an unlinked timer into the slot appropriate for its tick
+   */
+  void
+  place(TimerWheelHook& timer);
+
+  /** \brief process all ticks up to and including the tick of current time
+   */
+  void
+  advance();
+
+  /** \brief re-place all timers in a slot of a higher level
+   */
+  void
+  cascade(size_t level, size_t slot);
+
+  /** \brief fire all timers in the level-0 slot of current tick
+   */
+  void
+  expireCurrentSlot();
+
+  /** \brief schedule the next call to advance(), if it is needed before the current one
+   */
+  void
+  scheduleWakeup(uint64_t tick);
+
+  /** \brief schedule the next call to advance() after processing
+   */
+  void
+  scheduleNextWakeup();
+
+public:
+  static constexpr size_t N_LEVELS = 4;
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+
+private:
+  ExpireCallback m_expireCallback;
+  const time::nanoseconds m_tickDuration;
+  const time::steady_clock::TimePoint m_origin;
+
+  /** \brief the last tick that has been processed
+   */
+  uint64_t m_currentTick;
+
+  /** \brief sentinel nodes of slot lists
+   */
+  std::array<std::array<TimerWheelHook, N_SLOTS>, N_LEVELS> m_slots;
+  size_t m_size;
+
+  scheduler::ScopedEventId m_wakeupEvent;
+  /** \brief the tick at which m_wakeupEvent fires; meaningful only if m_hasWakeup is true
+   */
+  uint64_t m_wakeupTick;
+  bool m_hasWakeup;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_TIMER_WHEEL_HPP
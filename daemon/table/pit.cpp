@@ -24,6 +24,7 @@
  */
 
 #include "pit.hpp"
+#include "pit-entry-allocator.hpp"
 
 namespace nfd {
 namespace pit {
@@ -70,6 +71,9 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
       return entry->canMatch(interest, nteNameLen);
     });
   if (it != pitEntries.end()) {
+    if (allowInsert) {
+      m_statistics.recordInsert(name, false, (*it)->m_isStraggler);
+    }
     return {*it, false};
   }
 
@@ -78,9 +82,12 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
-  auto entry = make_shared<Entry>(interest);
+  auto entry = allocate_shared<Entry>(EntryAllocator<Entry>(), interest);
+  entry->m_faceIndex = &m_faceIndex;
+  entry->m_handle = m_handles.add(*entry);
   nte->insertPitEntry(entry);
   ++m_nItems;
+  m_statistics.recordInsert(name, true, false);
   return {entry, true};
 }
 
@@ -106,6 +113,21 @@ Pit::erase(Entry* entry, bool canDeleteNte)
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  // the entry may outlive its removal from the PIT, so detach it from the face index
+  for (InRecord& inRecord : entry->m_inRecords) {
+    m_faceIndex.erase(inRecord);
+  }
+  for (OutRecord& outRecord : entry->m_outRecords) {
+    m_faceIndex.erase(outRecord);
+  }
+  entry->m_faceIndex = nullptr;
+
+  m_handles.remove(entry->m_handle);
+  entry->m_handle = EntryHandle();
+
+  m_statistics.recordErase(time::steady_clock::now() - entry->getCreationTime(),
+                           entry->m_isStraggler, entry->m_isSatisfied);
+
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
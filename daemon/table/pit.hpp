@@ -28,6 +28,7 @@
 
 #include "pit-entry.hpp"
 #include "pit-iterator.hpp"
+#include "pit-statistics.hpp"
 
 namespace nfd {
 namespace pit {
@@ -78,6 +79,15 @@ public:
     return this->findOrInsert(interest, true);
   }
 
+  /** \brief resolves a handle obtained from Entry::getHandle
+   *  \return the entry, or nullptr if it has been erased from this PIT
+   */
+  Entry*
+  get(const EntryHandle& handle) const
+  {
+    return m_handles.get(handle);
+  }
+
   /** \brief performs a Data match
    *  \return an iterable of all PIT entries matching data
    */
@@ -97,6 +107,43 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+  /** \brief forgets \p face in the per-face index of in-records and out-records
+   *
+   *  This must be called when \p face is removed, after deleteInOutRecords has been called
+   *  for every entry returned by findEntriesByFace. The index keeps an entry for every face
+   *  that ever had a record, even after all its records are gone, until this is called.
+   */
+  void
+  eraseFace(const Face& face)
+  {
+    m_faceIndex.eraseIfEmpty(face);
+  }
+
+  /** \brief finds all entries that have an in-record or out-record for \p face
+   *
+   *  This uses a per-face index of in-records and out-records, and does not enumerate the NameTree.
+   *  \return a snapshot of matching entries, in unspecified order
+   */
+  std::vector<Entry*>
+  findEntriesByFace(const Face& face) const
+  {
+    return m_faceIndex.findEntries(face);
+  }
+
+  /** \return aggregation and residency statistics
+   */
+  const Statistics&
+  getStatistics() const
+  {
+    return m_statistics;
+  }
+
+  Statistics&
+  getStatistics()
+  {
+    return m_statistics;
+  }
+
 public: // enumeration
   typedef Iterator const_iterator;
 
@@ -135,6 +182,11 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  HandleTable m_handles;
+  Statistics m_statistics;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  FaceRecordIndex m_faceIndex;
 };
 
 } // namespace pit
@@ -45,10 +45,13 @@ nteHasStrategyChoiceEntry(const name_tree::Entry& nte)
   return nte.getStrategyChoiceEntry() != nullptr;
 }
 
+uint64_t StrategyChoice::s_lastGeneration = 0;
+
 StrategyChoice::StrategyChoice(Forwarder& forwarder)
   : m_forwarder(forwarder)
   , m_nameTree(m_forwarder.getNameTree())
   , m_nItems(0)
+  , m_generation(++s_lastGeneration)
 {
 }
 
@@ -64,6 +67,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
   name_tree::Entry& nte = m_nameTree.lookup(Name());
   nte.setStrategyChoiceEntry(std::move(entry));
   ++m_nItems;
+  this->bumpGeneration();
 }
 
 StrategyChoice::InsertResult
@@ -110,6 +114,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(std::move(strategy));
+  this->bumpGeneration();
   return InsertResult::OK;
 }
 
@@ -159,6 +164,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
+  this->bumpGeneration();
 }
 
 std::pair<bool, Name>
@@ -192,16 +198,50 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
   return this->findEffectiveStrategyImpl(prefix);
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategyCached(const name_tree::Entry& nte) const
+{
+  Strategy* strategy = nte.getCachedStrategy(m_generation);
+  if (strategy != nullptr) {
+    return *strategy;
+  }
+
+  if (nte.getStrategyChoiceEntry() != nullptr) {
+    strategy = &nte.getStrategyChoiceEntry()->getStrategy();
+  }
+  else {
+    BOOST_ASSERT(nte.getParent() != nullptr);
+    strategy = &this->findEffectiveStrategyCached(*nte.getParent());
+  }
+  nte.setCachedStrategy(*strategy, m_generation);
+  return *strategy;
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  return this->findEffectiveStrategyImpl(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+
+  // PIT entry attached to a shorter prefix: StrategyChoice entries may exist deeper
+  if (nte->getName().size() < pitEntry.getName().size()) {
+    return this->findEffectiveStrategyImpl(pitEntry);
+  }
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  return this->findEffectiveStrategyImpl(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategyCached(*nte);
+}
+
+void
+StrategyChoice::bumpGeneration()
+{
+  m_generation = ++s_lastGeneration;
 }
 
 static inline void
@@ -180,6 +180,21 @@ private:
   fw::Strategy&
   findEffectiveStrategyImpl(const K& key) const;
 
+  /** \brief get effective strategy of \p nte, using and filling the cache on NameTree entries
+   *
+   *  A NameTree entry without a cached strategy takes the strategy of its StrategyChoice
+   *  entry, or otherwise that of its parent, which is cached in turn.
+   */
+  fw::Strategy&
+  findEffectiveStrategyCached(const name_tree::Entry& nte) const;
+
+  /** \brief invalidates effective strategies cached on NameTree entries
+   *
+   *  This must be called whenever a StrategyChoice entry is inserted, changed, or erased.
+   */
+  void
+  bumpGeneration();
+
   Range
   getRange() const;
 
@@ -187,6 +202,14 @@ private:
   Forwarder& m_forwarder;
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  /** \brief generation of effective strategies cached on NameTree entries
+   *
+   *  Generation numbers are unique across StrategyChoice instances, so that a cache
+   *  stored by one instance is never mistaken as valid by another.
+   */
+  uint64_t m_generation;
+  static uint64_t s_lastGeneration;
 };
 
 std::ostream&
@@ -24,13 +24,146 @@
  */
 
 #include "strategy-info-host.hpp"
+#include "pit-entry-allocator.hpp"
 
 namespace nfd {
 
+const size_t StrategyInfoHost::N_INLINE_SLOTS;
+
+namespace {
+
+/** \brief number of items in each slab of a slot's memory pool
+ */
+const size_t SLOT_POOL_BLOCKS_PER_SLAB = 1024;
+
+struct SlotType
+{
+  int typeId;
+  unique_ptr<pit::SlabPool> pool;
+};
+
+/** \return types assigned to slots, indexed by slot
+ *  \note The registry is never destroyed, because a host may release its items
+ *        during static destruction.
+ */
+std::vector<SlotType>&
+getSlotTypes()
+{
+  static std::vector<SlotType>* slotTypes = new std::vector<SlotType>();
+  return *slotTypes;
+}
+
+} // unnamed namespace
+
+StrategyInfoHost::StrategyInfoHost()
+{
+  m_slots.fill(nullptr);
+}
+
+StrategyInfoHost::StrategyInfoHost(StrategyInfoHost&& other) noexcept
+  : m_slots(other.m_slots)
+  , m_overflow(std::move(other.m_overflow))
+{
+  other.m_slots.fill(nullptr);
+}
+
+StrategyInfoHost&
+StrategyInfoHost::operator=(StrategyInfoHost&& other) noexcept
+{
+  if (this != &other) {
+    this->clearStrategyInfo();
+    m_slots = other.m_slots;
+    m_overflow = std::move(other.m_overflow);
+    other.m_slots.fill(nullptr);
+  }
+  return *this;
+}
+
+StrategyInfoHost::~StrategyInfoHost()
+{
+  this->clearStrategyInfo();
+}
+
+size_t
+StrategyInfoHost::registerType(int typeId, size_t size, size_t alignment)
+{
+  BOOST_ASSERT(alignment <= pit::SlabPool::BLOCK_ALIGNMENT);
+
+  std::vector<SlotType>& slotTypes = getSlotTypes();
+  auto it = std::find_if(slotTypes.begin(), slotTypes.end(),
+                         [typeId] (const SlotType& slotType) { return slotType.typeId == typeId; });
+  if (it != slotTypes.end()) {
+    BOOST_ASSERT(size <= it->pool->getBlockSize());
+    return std::distance(slotTypes.begin(), it);
+  }
+
+  slotTypes.push_back({typeId, make_unique<pit::SlabPool>(size, SLOT_POOL_BLOCKS_PER_SLAB)});
+  return slotTypes.size() - 1;
+}
+
+void*
+StrategyInfoHost::allocateItem(size_t slot)
+{
+  return getSlotTypes()[slot].pool->allocate();
+}
+
+void
+StrategyInfoHost::deallocateItem(size_t slot, void* block)
+{
+  getSlotTypes()[slot].pool->deallocate(block);
+}
+
+fw::StrategyInfo*&
+StrategyInfoHost::getItemRef(size_t slot)
+{
+  if (slot < N_INLINE_SLOTS) {
+    return m_slots[slot];
+  }
+
+  if (m_overflow == nullptr) {
+    m_overflow = make_unique<std::vector<fw::StrategyInfo*>>();
+  }
+  if (slot - N_INLINE_SLOTS >= m_overflow->size()) {
+    m_overflow->resize(slot - N_INLINE_SLOTS + 1, nullptr);
+  }
+  return (*m_overflow)[slot - N_INLINE_SLOTS];
+}
+
+void
+StrategyInfoHost::destroyItem(size_t slot, fw::StrategyInfo*& item)
+{
+  item->~StrategyInfo();
+  deallocateItem(slot, item);
+  item = nullptr;
+}
+
+size_t
+StrategyInfoHost::eraseItem(size_t slot)
+{
+  if (this->getItem(slot) == nullptr) {
+    return 0;
+  }
+  this->destroyItem(slot, this->getItemRef(slot));
+  return 1;
+}
+
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (size_t slot = 0; slot < N_INLINE_SLOTS; ++slot) {
+    if (m_slots[slot] != nullptr) {
+      this->destroyItem(slot, m_slots[slot]);
+    }
+  }
+
+  if (m_overflow != nullptr) {
+    for (size_t i = 0; i < m_overflow->size(); ++i) {
+      if ((*m_overflow)[i] != nullptr) {
+        this->destroyItem(N_INLINE_SLOTS + i, (*m_overflow)[i]);
+      }
+    }
+    m_overflow.reset();
+  }
 }
 
 } // namespace nfd
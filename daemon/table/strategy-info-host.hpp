@@ -28,13 +28,34 @@
 
 #include "fw/strategy-info.hpp"
 
+#include <array>
+
 namespace nfd {
 
 /** \brief base class for an entity onto which StrategyInfo items may be placed
+ *
+ *  Each StrategyInfo type is assigned a slot when it is first used. A host keeps items of the
+ *  first N_INLINE_SLOTS types in a fixed array, so that finding an item is a single indexed load;
+ *  items of further types are kept in an overflow array allocated on demand.
+ *  Items are allocated from a memory pool of their slot rather than the general-purpose allocator.
  */
 class StrategyInfoHost
 {
 public:
+  StrategyInfoHost();
+
+  StrategyInfoHost(const StrategyInfoHost&) = delete;
+
+  StrategyInfoHost(StrategyInfoHost&& other) noexcept;
+
+  StrategyInfoHost&
+  operator=(const StrategyInfoHost&) = delete;
+
+  StrategyInfoHost&
+  operator=(StrategyInfoHost&& other) noexcept;
+
+  ~StrategyInfoHost();
+
   /** \brief get a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of fw::StrategyInfo
    *  \return an existing StrategyInfo item of type T, or nullptr if it does not exist
@@ -46,11 +67,7 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    auto it = m_items.find(T::getTypeId());
-    if (it == m_items.end()) {
-      return nullptr;
-    }
-    return static_cast<T*>(it->second.get());
+    return static_cast<T*>(this->getItem(getSlot<T>()));
   }
 
   /** \brief insert a StrategyInfo item
@@ -65,12 +82,20 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    unique_ptr<fw::StrategyInfo>& item = m_items[T::getTypeId()];
+    size_t slot = getSlot<T>();
+    fw::StrategyInfo*& item = this->getItemRef(slot);
     bool isNew = (item == nullptr);
     if (isNew) {
-      item.reset(new T(std::forward<A>(args)...));
+      void* block = allocateItem(slot);
+      try {
+        item = new (block) T(std::forward<A>(args)...);
+      }
+      catch (...) {
+        deallocateItem(slot, block);
+        throw;
+      }
     }
-    return {static_cast<T*>(item.get()), isNew};
+    return {static_cast<T*>(item), isNew};
   }
 
   /** \brief erase a StrategyInfo item
@@ -84,7 +109,7 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    return m_items.erase(T::getTypeId());
+    return this->eraseItem(getSlot<T>());
   }
 
   /** \brief clear all StrategyInfo items
@@ -92,8 +117,59 @@ public:
   void
   clearStrategyInfo();
 
+public:
+  /** \brief number of slots stored in each host without additional allocation
+   */
+  static const size_t N_INLINE_SLOTS = 8;
+
+private:
+  /** \return slot of StrategyInfo type T
+   */
+  template<typename T>
+  static size_t
+  getSlot()
+  {
+    static const size_t slot = registerType(T::getTypeId(), sizeof(T), alignof(T));
+    return slot;
+  }
+
+  /** \brief assign a slot to a StrategyInfo type
+   *
+   *  Types with the same TypeId share a slot.
+   */
+  static size_t
+  registerType(int typeId, size_t size, size_t alignment);
+
+  static void*
+  allocateItem(size_t slot);
+
+  static void
+  deallocateItem(size_t slot, void* block);
+
+  fw::StrategyInfo*
+  getItem(size_t slot) const
+  {
+    if (slot < N_INLINE_SLOTS) {
+      return m_slots[slot];
+    }
+    if (m_overflow == nullptr || slot - N_INLINE_SLOTS >= m_overflow->size()) {
+      return nullptr;
+    }
+    return (*m_overflow)[slot - N_INLINE_SLOTS];
+  }
+
+  fw::StrategyInfo*&
+  getItemRef(size_t slot);
+
+  size_t
+  eraseItem(size_t slot);
+
+  void
+  destroyItem(size_t slot, fw::StrategyInfo*& item);
+
 private:
-  std::unordered_map<int, unique_ptr<fw::StrategyInfo>> m_items;
+  std::array<fw::StrategyInfo*, N_INLINE_SLOTS> m_slots;
+  unique_ptr<std::vector<fw::StrategyInfo*>> m_overflow;
 };
 
 } // namespace nfd
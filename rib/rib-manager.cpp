@@ -38,6 +38,9 @@
 #include <ndn-cxx/mgmt/nfd/face-status.hpp>
 #include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
 
+#include <boost/filesystem.hpp>
+#include <fstream>
+
 namespace nfd {
 namespace rib {
 
@@ -48,6 +51,8 @@ const Name RibManager::LOCAL_HOP_TOP_PREFIX = "/localhop/nfd";
 const std::string RibManager::MGMT_MODULE_NAME = "rib";
 const Name RibManager::FACES_LIST_DATASET_PREFIX = "/localhost/nfd/faces/list";
 const time::seconds RibManager::ACTIVE_FACE_FETCH_INTERVAL = time::seconds(300);
+const time::seconds RibManager::SNAPSHOT_SAVE_DELAY = time::seconds(5);
+const size_t RibManager::SNAPSHOT_BATCH_SIZE = 256;
 const Name RibManager::READVERTISE_NLSR_PREFIX = "/localhost/nlsr";
 
 RibManager::RibManager(Dispatcher& dispatcher,
@@ -66,6 +71,8 @@ RibManager::RibManager(Dispatcher& dispatcher,
   , m_addTopPrefix([&dispatcher] (const Name& topPrefix) {
       dispatcher.addTopPrefix(topPrefix, false);
     })
+  , m_hasLoadedSnapshot(false)
+  , m_isSnapshotSaveScheduled(false)
 {
   registerCommandHandler<ndn::nfd::RibRegisterCommand>("register",
     bind(&RibManager::registerEntry, this, _2, _3, _4, _5));
@@ -73,9 +80,18 @@ RibManager::RibManager(Dispatcher& dispatcher,
     bind(&RibManager::unregisterEntry, this, _2, _3, _4, _5));
 
   registerStatusDatasetHandler("list", bind(&RibManager::listEntries, this, _1, _2, _3));
+
+  m_rib.afterAddRoute.connect([this] (const RibRouteRef&) { scheduleSnapshotSave(); });
+  m_rib.beforeRemoveRoute.connect([this] (const RibRouteRef&) { scheduleSnapshotSave(); });
 }
 
-RibManager::~RibManager() = default;
+RibManager::~RibManager()
+{
+  // routes changed since the last save would be lost otherwise
+  if (!m_snapshotPath.empty() && m_hasLoadedSnapshot) {
+    saveSnapshot();
+  }
+}
 
 void
 RibManager::registerWithNfd()
@@ -90,7 +106,8 @@ RibManager::registerWithNfd()
   m_faceMonitor.onNotification.connect(bind(&RibManager::onNotification, this, _1));
   m_faceMonitor.start();
 
-  scheduleActiveFaceFetch(ACTIVE_FACE_FETCH_INTERVAL);
+  // the snapshot is loaded as soon as the FaceIds of its routes are known
+  scheduleActiveFaceFetch(m_snapshotPath.empty() ? ACTIVE_FACE_FETCH_INTERVAL : time::seconds(0));
 }
 
 void
@@ -114,6 +131,9 @@ void
 RibManager::onRibUpdateSuccess(const RibUpdate& update)
 {
   NFD_LOG_DEBUG("RIB update succeeded for " << update);
+
+  // an updated route does not trigger Rib signals
+  scheduleSnapshotSave();
 }
 
 void
@@ -133,6 +153,7 @@ RibManager::onConfig(const ConfigSection& configSection,
 {
   bool isAutoPrefixPropagatorEnabled = false;
   bool wantReadvertiseToNlsr = false;
+  std::string snapshotPath;
 
   for (const auto& item : configSection) {
     if (item.first == "localhost_security") {
@@ -156,6 +177,14 @@ RibManager::onConfig(const ConfigSection& configSection,
     else if (item.first == "readvertise_nlsr") {
       wantReadvertiseToNlsr = ConfigFile::parseYesNo(item, "rib.readvertise_nlsr");
     }
+    else if (item.first == "snapshot") {
+      std::string path = item.second.get_value<std::string>();
+      if (path.empty()) {
+        BOOST_THROW_EXCEPTION(Error("Invalid value for option rib.snapshot"));
+      }
+      snapshotPath = boost::filesystem::absolute(path,
+                       boost::filesystem::path(filename).parent_path()).string();
+    }
     else {
       BOOST_THROW_EXCEPTION(Error("Unrecognized rib property: " + item.first));
     }
@@ -165,6 +194,10 @@ RibManager::onConfig(const ConfigSection& configSection,
     m_prefixPropagator.disable();
   }
 
+  if (!isDryRun) {
+    m_snapshotPath = snapshotPath;
+  }
+
   if (wantReadvertiseToNlsr && m_readvertiseNlsr == nullptr) {
     NFD_LOG_DEBUG("Enabling readvertise-to-nlsr.");
     m_readvertiseNlsr.reset(new Readvertise(
@@ -203,6 +236,33 @@ RibManager::registerEntry(const Name& topPrefix, const Interest& interest,
   // Respond since command is valid and authorized
   done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
 
+  beginRegisterRoute(parameters);
+}
+
+void
+RibManager::beginRegisterRoute(const ControlParameters& parameters)
+{
+  Route route = makeRoute(parameters);
+
+  NFD_LOG_INFO("Adding route " << parameters.getName() << " nexthop=" << route.faceId
+                                                       << " origin=" << route.origin
+                                                       << " cost=" << route.cost);
+
+  RibUpdate update;
+  update.setAction(RibUpdate::REGISTER)
+        .setName(parameters.getName())
+        .setRoute(route);
+
+  m_rib.beginApplyUpdate(update,
+                         bind(&RibManager::onRibUpdateSuccess, this, update),
+                         bind(&RibManager::onRibUpdateFailure, this, update, _1, _2));
+
+  m_registeredFaces.insert(route.faceId);
+}
+
+Route
+RibManager::makeRoute(const ControlParameters& parameters)
+{
   Route route;
   route.faceId = parameters.getFaceId();
   route.origin = parameters.getOrigin();
@@ -227,20 +287,7 @@ RibManager::registerEntry(const Name& topPrefix, const Interest& interest,
     route.expires = ndn::nullopt;
   }
 
-  NFD_LOG_INFO("Adding route " << parameters.getName() << " nexthop=" << route.faceId
-                                                       << " origin=" << route.origin
-                                                       << " cost=" << route.cost);
-
-  RibUpdate update;
-  update.setAction(RibUpdate::REGISTER)
-        .setName(parameters.getName())
-        .setRoute(route);
-
-  m_rib.beginApplyUpdate(update,
-                         bind(&RibManager::onRibUpdateSuccess, this, update),
-                         bind(&RibManager::onRibUpdateFailure, this, update, _1, _2));
-
-  m_registeredFaces.insert(route.faceId);
+  return route;
 }
 
 void
@@ -378,6 +425,24 @@ RibManager::removeInvalidFaces(const std::vector<ndn::nfd::FaceStatus>& activeFa
     }
   }
 
+  if (!m_snapshotPath.empty()) {
+    m_snapshotFaces.clear();
+    for (const auto& faceStatus : activeFaces) {
+      updateSnapshotFace(faceStatus.getFaceId(), faceStatus.getRemoteUri(),
+                         faceStatus.getLocalUri(), faceStatus.getFacePersistency());
+    }
+
+    if (m_hasLoadedSnapshot) {
+      // catch up with missed face creation events
+      registerPendingRoutes();
+      saveSnapshot();
+    }
+    else {
+      loadSnapshot();
+      m_hasLoadedSnapshot = true;
+    }
+  }
+
   // Reschedule the check for future clean up
   scheduleActiveFaceFetch(ACTIVE_FACE_FETCH_INTERVAL);
 }
@@ -392,7 +457,233 @@ RibManager::onNotification(const ndn::nfd::FaceEventNotification& notification)
 
     scheduler::schedule(time::seconds(0),
                         bind(&RibManager::onFaceDestroyedEvent, this, notification.getFaceId()));
+    m_snapshotFaces.erase(notification.getFaceId());
+  }
+  else if (!m_snapshotPath.empty() &&
+           (notification.getKind() == ndn::nfd::FACE_EVENT_CREATED ||
+            notification.getKind() == ndn::nfd::FACE_EVENT_UPDATED)) {
+    updateSnapshotFace(notification.getFaceId(), notification.getRemoteUri(),
+                       notification.getLocalUri(), notification.getFacePersistency());
+
+    // a pending snapshot route may be waiting for this face
+    if (m_hasLoadedSnapshot && !m_pendingRoutes.empty()) {
+      registerPendingRoutes();
+    }
+  }
+}
+
+void
+RibManager::updateSnapshotFace(uint64_t faceId, const std::string& remoteUri,
+                               const std::string& localUri, ndn::nfd::FacePersistency persistency)
+{
+  // routes toward on-demand faces are not saved, because their FaceUris are not stable
+  if (persistency == ndn::nfd::FACE_PERSISTENCY_ON_DEMAND) {
+    m_snapshotFaces.erase(faceId);
+  }
+  else {
+    m_snapshotFaces[faceId] = FaceUris(remoteUri, localUri);
+  }
+}
+
+void
+RibManager::scheduleSnapshotSave()
+{
+  if (m_snapshotPath.empty() || !m_hasLoadedSnapshot || m_isSnapshotSaveScheduled) {
+    return;
+  }
+
+  m_isSnapshotSaveScheduled = true;
+  m_snapshotSaveEvent = scheduler::schedule(SNAPSHOT_SAVE_DELAY, [this] {
+    m_isSnapshotSaveScheduled = false;
+    saveSnapshot();
+  });
+}
+
+void
+RibManager::saveSnapshot()
+{
+  std::string tmpPath = m_snapshotPath + ".tmp";
+  std::ofstream os(tmpPath, std::ios::binary | std::ios::trunc);
+  auto writeRoute = [&os] (const ControlParameters& parameters) {
+    const Block& block = parameters.wireEncode();
+    os.write(reinterpret_cast<const char*>(block.wire()), block.size());
+  };
+
+  auto now = time::steady_clock::now();
+  size_t nSaved = 0;
+  for (const auto& kv : m_rib) {
+    for (const Route& route : kv.second->getRoutes()) {
+      auto face = m_snapshotFaces.find(route.faceId);
+      if (face == m_snapshotFaces.end() || (route.expires && *route.expires <= now)) {
+        continue;
+      }
+
+      ControlParameters parameters;
+      parameters.setName(kv.first)
+                .setUri(face->second.first)
+                .setLocalUri(face->second.second)
+                .setOrigin(route.origin)
+                .setCost(route.cost)
+                .setFlags(route.flags);
+      if (route.expires) {
+        parameters.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
+      }
+      writeRoute(parameters);
+      ++nSaved;
+    }
+  }
+
+  for (const PendingRoute& pending : m_pendingRoutes) {
+    if (pending.expires && *pending.expires <= now) {
+      continue;
+    }
+
+    ControlParameters parameters = pending.parameters;
+    if (pending.expires) {
+      parameters.setExpirationPeriod(time::duration_cast<time::milliseconds>(*pending.expires - now));
+    }
+    writeRoute(parameters);
+    ++nSaved;
+  }
+
+  os.close();
+  if (!os) {
+    NFD_LOG_WARN("Cannot write RIB snapshot " << tmpPath);
+    return;
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tmpPath, m_snapshotPath, ec);
+  if (ec) {
+    NFD_LOG_WARN("Cannot replace RIB snapshot " << m_snapshotPath << ": " << ec.message());
+    return;
+  }
+
+  NFD_LOG_DEBUG("Saved " << nSaved << " routes to RIB snapshot " << m_snapshotPath);
+}
+
+size_t
+RibManager::loadSnapshot()
+{
+  boost::system::error_code ec;
+  if (!boost::filesystem::is_regular_file(m_snapshotPath, ec)) {
+    NFD_LOG_INFO("No RIB snapshot at " << m_snapshotPath);
+    return 0;
+  }
+
+  std::ifstream is(m_snapshotPath, std::ios::binary);
+  std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+  // decode the whole snapshot before registering anything
+  auto now = time::steady_clock::now();
+  std::list<PendingRoute> records;
+  try {
+    for (size_t offset = 0; offset < buffer.size();) {
+      bool isOk = false;
+      Block block;
+      std::tie(isOk, block) = Block::fromBuffer(buffer.data() + offset, buffer.size() - offset);
+      if (!isOk) {
+        BOOST_THROW_EXCEPTION(tlv::Error("truncated at offset " + to_string(offset)));
+      }
+
+      PendingRoute record{ControlParameters(block), ndn::nullopt};
+      if (!record.parameters.hasName() || !record.parameters.hasUri() ||
+          !record.parameters.hasLocalUri()) {
+        BOOST_THROW_EXCEPTION(tlv::Error("incomplete route at offset " + to_string(offset)));
+      }
+      if (record.parameters.hasExpirationPeriod() &&
+          record.parameters.getExpirationPeriod() != time::milliseconds::max()) {
+        record.expires = now + record.parameters.getExpirationPeriod();
+      }
+      record.parameters.unsetExpirationPeriod();
+      records.push_back(std::move(record));
+
+      offset += block.size();
+    }
   }
+  catch (const tlv::Error& e) {
+    NFD_LOG_WARN("Ignoring malformed RIB snapshot " << m_snapshotPath << ": " << e.what());
+    return 0;
+  }
+
+  size_t nRecords = records.size();
+  m_pendingRoutes.splice(m_pendingRoutes.end(), records);
+  size_t nLoaded = registerPendingRoutes();
+
+  NFD_LOG_INFO("Loaded " << nLoaded << " of " << nRecords << " routes from RIB snapshot "
+               << m_snapshotPath << ", " << m_pendingRoutes.size() << " waiting for their faces");
+  return nLoaded;
+}
+
+size_t
+RibManager::registerPendingRoutes()
+{
+  std::map<FaceUris, uint64_t> faceIds;
+  for (const auto& kv : m_snapshotFaces) {
+    faceIds.emplace(kv.second, kv.first);
+  }
+
+  // routes are grouped by (name length, occurrence of the name), so that no name in a group
+  // is a prefix of another; shorter names are registered first
+  std::map<std::pair<size_t, size_t>, RibUpdateList> groups;
+  std::map<Name, size_t> nOccurrences;
+  auto now = time::steady_clock::now();
+  size_t nRegistered = 0;
+
+  for (auto it = m_pendingRoutes.begin(); it != m_pendingRoutes.end();) {
+    if (it->expires && *it->expires <= now) {
+      it = m_pendingRoutes.erase(it);
+      continue;
+    }
+
+    ControlParameters& parameters = it->parameters;
+    auto faceId = faceIds.find(FaceUris(parameters.getUri(), parameters.getLocalUri()));
+    if (faceId == faceIds.end()) {
+      ++it;
+      continue;
+    }
+
+    parameters.setFaceId(faceId->second);
+    if (it->expires) {
+      parameters.setExpirationPeriod(time::duration_cast<time::milliseconds>(*it->expires - now));
+    }
+
+    RibUpdate update;
+    update.setAction(RibUpdate::REGISTER)
+          .setName(parameters.getName())
+          .setRoute(makeRoute(parameters));
+    const Name& name = parameters.getName();
+    groups[std::make_pair(name.size(), nOccurrences[name]++)].push_back(update);
+
+    m_registeredFaces.insert(faceId->second);
+    ++nRegistered;
+    it = m_pendingRoutes.erase(it);
+  }
+
+  for (const auto& group : groups) {
+    RibUpdateList::const_iterator it = group.second.begin();
+    while (it != group.second.end()) {
+      // FibUpdater tolerates FACE_NOT_FOUND for faces other than the batch FaceId, so a face
+      // destroyed meanwhile does not fail the routes toward other faces
+      RibUpdateBatch batch(ndn::nfd::INVALID_FACE_ID);
+      for (; it != group.second.end() && batch.size() < SNAPSHOT_BATCH_SIZE; ++it) {
+        batch.add(*it);
+      }
+
+      size_t nRoutes = batch.size();
+      m_rib.beginApplyBatch(batch,
+        [nRoutes] {
+          NFD_LOG_DEBUG("Registered a batch of " << nRoutes << " snapshot routes");
+        },
+        [this] (uint32_t code, const std::string& error) {
+          NFD_LOG_DEBUG("Failed to register a batch of snapshot routes (code: " << code
+                        << ", error: " << error << ")");
+          scheduleActiveFaceFetch(time::seconds(1));
+        });
+    }
+  }
+
+  return nRegistered;
 }
 
 void
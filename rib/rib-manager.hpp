@@ -96,6 +96,18 @@ private: // ControlCommand and StatusDataset
                   ControlParameters parameters,
                   const ndn::mgmt::CommandContinuation& done);
 
+  /** \brief adds the route described by \p parameters to the RIB
+   *  \pre parameters has Name and FaceId
+   */
+  void
+  beginRegisterRoute(const ControlParameters& parameters);
+
+  /** \brief makes the Route described by \p parameters, and schedules its expiration
+   *  \pre parameters has Name and FaceId
+   */
+  Route
+  makeRoute(const ControlParameters& parameters);
+
   void
   listEntries(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
@@ -136,6 +148,53 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   onNotification(const ndn::nfd::FaceEventNotification& notification);
 
+PUBLIC_WITH_TESTS_ELSE_PRIVATE: // snapshot
+  /** \brief records the FaceUris of a face if it is persistent or permanent
+   */
+  void
+  updateSnapshotFace(uint64_t faceId, const std::string& remoteUri, const std::string& localUri,
+                     ndn::nfd::FacePersistency persistency);
+
+  /** \brief schedules saveSnapshot() after SNAPSHOT_SAVE_DELAY, unless a save is already pending
+   *
+   *  Nothing is scheduled before the snapshot has been loaded, so that routes from the previous
+   *  run are not overwritten by an incomplete RIB.
+   */
+  void
+  scheduleSnapshotSave();
+
+  /** \brief writes all routes toward persistent and permanent faces to the snapshot file
+   *
+   *  The snapshot is a sequence of ControlParameters blocks, one per route, in the same format
+   *  as the parameters of a rib/register command, except that the nexthop face is identified
+   *  by its Uri and LocalUri instead of FaceId, because FaceIds are reassigned when NFD restarts.
+   *  Pending routes are written as well. The file is replaced atomically.
+   */
+  void
+  saveSnapshot();
+
+  /** \brief reads the snapshot file into m_pendingRoutes, and registers the routes whose faces
+   *         exist
+   *
+   *  A malformed snapshot is ignored as a whole.
+   *
+   *  \return number of routes registered
+   */
+  size_t
+  loadSnapshot();
+
+  /** \brief registers the pending routes whose faces exist, and drops expired pending routes
+   *
+   *  Each route is bound to the face with the same Uri and LocalUri. Routes are applied to the
+   *  FIB in batches of up to SNAPSHOT_BATCH_SIZE routes, whose FIB updates are sent together.
+   *  Because FibUpdater computes every update in a batch against the RIB as it was before
+   *  the batch, a batch contains routes of a single name length, and at most one route per name.
+   *
+   *  \return number of routes registered
+   */
+  size_t
+  registerPendingRoutes();
+
 private:
   void
   onCommandPrefixAddNextHopSuccess(const Name& prefix, const ControlParameters& result);
@@ -170,6 +229,8 @@ private:
   static const std::string MGMT_MODULE_NAME;
   static const Name FACES_LIST_DATASET_PREFIX;
   static const time::seconds ACTIVE_FACE_FETCH_INTERVAL;
+  static const time::seconds SNAPSHOT_SAVE_DELAY;
+  static const size_t SNAPSHOT_BATCH_SIZE;
   scheduler::ScopedEventId m_activeFaceFetchEvent;
   static const Name READVERTISE_NLSR_PREFIX;
 
@@ -179,6 +240,44 @@ private:
   FaceIdSet m_registeredFaces;
 
   std::function<void(const Name& topPrefix)> m_addTopPrefix;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief path of the RIB snapshot file, or empty if snapshot is disabled
+   */
+  std::string m_snapshotPath;
+
+  /** \brief whether the snapshot has been loaded since startup
+   *
+   *  The snapshot is not saved until it has been loaded, so that routes from the previous run
+   *  are not overwritten by an incomplete RIB.
+   */
+  bool m_hasLoadedSnapshot;
+
+  typedef std::pair<std::string, std::string> FaceUris; ///< remote and local FaceUri
+
+  /** \brief FaceUris of persistent and permanent faces, by FaceId
+   *
+   *  This is filled from the Face dataset and kept up to date with face event notifications.
+   */
+  std::map<uint64_t, FaceUris> m_snapshotFaces;
+
+  /** \brief a snapshot route whose face does not exist yet
+   */
+  struct PendingRoute
+  {
+    ControlParameters parameters; ///< has Uri and LocalUri instead of FaceId
+    ndn::optional<time::steady_clock::TimePoint> expires;
+  };
+
+  /** \brief snapshot routes waiting for their faces to be created
+   *
+   *  They are kept in the snapshot when it is saved again, so that a face that comes up late
+   *  does not lose its routes.
+   */
+  std::list<PendingRoute> m_pendingRoutes;
+
+  scheduler::ScopedEventId m_snapshotSaveEvent;
+  bool m_isSnapshotSaveScheduled;
 };
 
 } // namespace rib
@@ -359,6 +359,19 @@ Rib::beginApplyUpdate(const RibUpdate& update,
   sendBatchFromQueue();
 }
 
+void
+Rib::beginApplyBatch(const RibUpdateBatch& batch,
+                     const Rib::UpdateSuccessCallback& onSuccess,
+                     const Rib::UpdateFailureCallback& onFailure)
+{
+  BOOST_ASSERT(batch.size() > 0);
+
+  UpdateQueueItem item{batch, onSuccess, onFailure};
+  m_updateBatches.push_back(std::move(item));
+
+  sendBatchFromQueue();
+}
+
 void
 Rib::beginRemoveFace(uint64_t faceId)
 {
@@ -400,9 +413,6 @@ Rib::sendBatchFromQueue()
 
   RibUpdateBatch& batch = item.batch;
 
-  // Until task #1698, each RibUpdateBatch contains exactly one RIB update
-  BOOST_ASSERT(batch.size() == 1);
-
   const Rib::UpdateSuccessCallback& managerSuccessCallback = item.managerSuccessCallback;
   const Rib::UpdateFailureCallback& managerFailureCallback = item.managerFailureCallback;
 
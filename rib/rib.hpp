@@ -128,6 +128,20 @@ public:
                    const UpdateSuccessCallback& onSuccess,
                    const UpdateFailureCallback& onFailure);
 
+  /** \brief passes the provided RibUpdateBatch to FibUpdater as a single unit
+   *
+   *  The FIB updates of all RibUpdates in the batch are sent to NFD together, and the RIB is
+   *  updated after all of them succeed.
+   *
+   *  \pre No name in \p batch is a prefix of another name in \p batch, including itself,
+   *       because FibUpdater computes the FIB updates of each RibUpdate against the RIB
+   *       as it was before the batch.
+   */
+  void
+  beginApplyBatch(const RibUpdateBatch& batch,
+                  const UpdateSuccessCallback& onSuccess,
+                  const UpdateFailureCallback& onFailure);
+
   /** \brief starts the FIB update process when a face has been destroyed
    */
   void
@@ -66,6 +66,23 @@ BOOST_AUTO_TEST_CASE(ByteCnt)
   BOOST_CHECK_EQUAL(counter, 21);
 }
 
+BOOST_AUTO_TEST_CASE(DurationCnt)
+{
+  DurationCounter counter;
+
+  uint64_t observation = counter; // implicit conversion
+  BOOST_CHECK_EQUAL(observation, 0);
+
+  counter += time::microseconds(3);
+  BOOST_CHECK_EQUAL(counter, 3000);
+  counter += time::nanoseconds(250);
+  counter += time::milliseconds(1);
+  BOOST_CHECK_EQUAL(counter, 1003250);
+
+  counter.set(7);
+  BOOST_CHECK_EQUAL(counter, 7);
+}
+
 BOOST_AUTO_TEST_CASE(SizeCnt)
 {
   std::vector<int> v;
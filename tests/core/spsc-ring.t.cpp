@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/spsc-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/thread.hpp>
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestSpscRing, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  SpscRing<std::string> ring(3);
+  BOOST_CHECK_EQUAL(ring.capacity(), 4);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+
+  std::string item;
+  BOOST_CHECK_EQUAL(ring.tryPop(item), false);
+
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(ring.tryPush(to_string(i)), true);
+  }
+  BOOST_CHECK_EQUAL(ring.size(), 4);
+  BOOST_CHECK_EQUAL(ring.tryPush(std::string("full")), false);
+
+  BOOST_CHECK_EQUAL(ring.tryPop(item), true);
+  BOOST_CHECK_EQUAL(item, "0");
+  BOOST_CHECK_EQUAL(ring.tryPush(std::string("4")), true);
+
+  for (int i = 1; i <= 4; ++i) {
+    BOOST_CHECK_EQUAL(ring.tryPop(item), true);
+    BOOST_CHECK_EQUAL(item, to_string(i));
+  }
+  BOOST_CHECK_EQUAL(ring.tryPop(item), false);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyNonEmpty)
+{
+  auto counted = make_shared<int>(0);
+  {
+    SpscRing<shared_ptr<int>> ring(8);
+    ring.tryPush(counted);
+    ring.tryPush(counted);
+    BOOST_CHECK_EQUAL(counted.use_count(), 3);
+  }
+  BOOST_CHECK_EQUAL(counted.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TwoThreads)
+{
+  const int N_ITEMS = 100000;
+  SpscRing<unique_ptr<int>> ring(64);
+
+  boost::thread producer([&ring, N_ITEMS] {
+    for (int i = 0; i < N_ITEMS;) {
+      unique_ptr<int> item = make_unique<int>(i);
+      if (ring.tryPush(std::move(item))) {
+        ++i;
+      }
+    }
+  });
+
+  int nReceived = 0;
+  bool isInOrder = true;
+  while (nReceived < N_ITEMS) {
+    unique_ptr<int> item;
+    if (ring.tryPop(item)) {
+      isInOrder = isInOrder && *item == nReceived;
+      ++nReceived;
+    }
+  }
+  producer.join();
+
+  BOOST_CHECK(isInOrder);
+  BOOST_CHECK_EQUAL(ring.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscRing
+
+} // namespace tests
+} // namespace nfd
@@ -25,6 +25,7 @@
 
 #include "unicast-udp-transport-fixture.hpp"
 #include "multicast-udp-transport-fixture.hpp"
+#include "face/io-thread.hpp"
 
 #include "transport-test-common.hpp"
 
@@ -150,6 +151,63 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Close, T, DatagramTransportFixtures, T)
   BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
 }
 
+class IoThreadGuard : noncopyable
+{
+public:
+  IoThreadGuard()
+  {
+    setIoThread(make_shared<IoThread>());
+  }
+
+  ~IoThreadGuard()
+  {
+    setIoThread(nullptr);
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveOnIoThread, T, DatagramTransportFixtures, T)
+{
+  IoThreadGuard ioThreadGuard;
+  TRANSPORT_TEST_INIT();
+  BOOST_REQUIRE(this->transport->isReceivingOnIoThread());
+
+  Block pkt = ndn::encoding::makeStringBlock(300, "hello");
+  ndn::Buffer buf(pkt.begin(), pkt.end());
+  this->remoteWrite(buf);
+  this->remoteWrite(buf);
+  this->remoteWrite({0x05, 0x03, 0x00, 0x01}); // incomplete, dropped on the forwarding thread
+
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInPackets, 2);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytes, 2 * pkt.size());
+  BOOST_CHECK_EQUAL(this->receivedPackets->size(), 2);
+  BOOST_CHECK_EQUAL(this->transport->getNRxRingDrops(), 0);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+
+  // sending still happens on the forwarding thread
+  this->transport->send(Transport::Packet{Block{pkt}});
+  std::vector<uint8_t> readBuf(pkt.size());
+  this->remoteRead(readBuf);
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), pkt.begin(), pkt.end());
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CloseOnIoThread, T, DatagramTransportFixtures, T)
+{
+  IoThreadGuard ioThreadGuard;
+  TRANSPORT_TEST_INIT();
+  BOOST_REQUIRE(this->transport->isReceivingOnIoThread());
+
+  this->transport->close();
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::CLOSING);
+
+  this->transport->afterStateChange.connectSingleShot([this] (TransportState oldState, TransportState newState) {
+    BOOST_CHECK_EQUAL(oldState, TransportState::CLOSING);
+    BOOST_CHECK_EQUAL(newState, TransportState::CLOSED);
+    this->limitedIo.afterOp();
+  });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestDatagramTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
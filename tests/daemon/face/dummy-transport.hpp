@@ -46,6 +46,8 @@ public:
                  ndn::nfd::LinkType linkType = ndn::nfd::LINK_TYPE_POINT_TO_POINT,
                  ssize_t mtu = MTU_UNLIMITED)
     : isClosed(false)
+    , sendQueueDelay(time::nanoseconds::zero())
+    , sendQueueLength(0)
   {
     this->setLocalUri(FaceUri(localUri));
     this->setRemoteUri(FaceUri(remoteUri));
@@ -67,6 +69,18 @@ public:
     this->Transport::setState(state);
   }
 
+  time::nanoseconds
+  getSendQueueDelay() const override
+  {
+    return sendQueueDelay;
+  }
+
+  size_t
+  getSendQueueLength() override
+  {
+    return sendQueueLength;
+  }
+
   void
   receivePacket(Packet&& packet)
   {
@@ -103,6 +117,8 @@ private:
 public:
   bool isClosed;
   std::vector<Packet> sentPackets;
+  time::nanoseconds sendQueueDelay;
+  size_t sendQueueLength;
 };
 
 } // namespace tests
@@ -24,7 +24,10 @@
  */
 
 #include "face/face-system.hpp"
+#include "face/generic-link-service.hpp"
+#include "face/io-thread.hpp"
 #include "face-system-fixture.hpp"
+#include "dummy-transport.hpp"
 
 #include "tests/test-common.hpp"
 
@@ -195,6 +198,140 @@ BOOST_AUTO_TEST_CASE(ChangeProvidedSchemes)
   BOOST_CHECK_EQUAL(faceSystem.getFactoryByScheme("s3"), f1);
 }
 
+BOOST_AUTO_TEST_CASE(IoThreadOption)
+{
+  const std::string CONFIG_YES = R"CONFIG(
+    face_system
+    {
+      io_thread yes
+    }
+  )CONFIG";
+
+  const std::string CONFIG_NO = R"CONFIG(
+    face_system
+    {
+      io_thread no
+    }
+  )CONFIG";
+
+  const std::string CONFIG_BAD = R"CONFIG(
+    face_system
+    {
+      io_thread maybe
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG_YES, true);
+  BOOST_CHECK(getIoThread() == nullptr);
+
+  parseConfig(CONFIG_YES, false);
+  shared_ptr<IoThread> ioThread = getIoThread();
+  BOOST_CHECK(ioThread != nullptr);
+
+  parseConfig(CONFIG_YES, false);
+  BOOST_CHECK_EQUAL(getIoThread(), ioThread); // existing thread is kept
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD, false), ConfigFile::Error);
+
+  parseConfig(CONFIG_NO, false);
+  BOOST_CHECK(getIoThread() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(CongestionOption)
+{
+  const std::string CONFIG_MARK = R"CONFIG(
+    face_system
+    {
+      congestion
+      {
+        target 10
+        threshold 30000
+        interval 200
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_DROP = R"CONFIG(
+    face_system
+    {
+      congestion
+      {
+        action drop
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_NONE = R"CONFIG(
+    face_system
+    {
+    }
+  )CONFIG";
+
+  const std::string CONFIG_BAD_ACTION = R"CONFIG(
+    face_system
+    {
+      congestion
+      {
+        action defer
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_UNKNOWN = R"CONFIG(
+    face_system
+    {
+      congestion
+      {
+        quantum 1500
+      }
+    }
+  )CONFIG";
+
+  auto makeFace = [] (ndn::nfd::FaceScope scope) {
+    return make_shared<Face>(make_unique<GenericLinkService>(),
+                             make_unique<DummyTransport>("dummy://", "dummy://", scope));
+  };
+  auto getOptions = [] (const Face& face) {
+    return static_cast<const GenericLinkService*>(face.getLinkService())->getOptions();
+  };
+
+  auto existingFace = makeFace(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  faceTable.add(existingFace);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).allowCongestionMarking, false);
+
+  parseConfig(CONFIG_MARK, true);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).allowCongestionMarking, false);
+
+  parseConfig(CONFIG_MARK, false);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).allowCongestionMarking, true);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).congestionTarget, time::milliseconds(10));
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).congestionThreshold, 30000);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).congestionInterval, time::milliseconds(200));
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).dropOnCongestion, false);
+
+  // applies to faces added later, except local faces
+  auto newFace = makeFace(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto localFace = makeFace(ndn::nfd::FACE_SCOPE_LOCAL);
+  faceTable.add(newFace);
+  faceTable.add(localFace);
+  BOOST_CHECK_EQUAL(getOptions(*newFace).allowCongestionMarking, true);
+  BOOST_CHECK_EQUAL(getOptions(*localFace).allowCongestionMarking, false);
+
+  parseConfig(CONFIG_DROP, false);
+  BOOST_CHECK_EQUAL(getOptions(*newFace).dropOnCongestion, true);
+  BOOST_CHECK_EQUAL(getOptions(*newFace).congestionTarget, GenericLinkService::Options().congestionTarget);
+  BOOST_CHECK_EQUAL(getOptions(*newFace).congestionThreshold,
+                    GenericLinkService::Options().congestionThreshold);
+
+  parseConfig(CONFIG_NONE, false);
+  BOOST_CHECK_EQUAL(getOptions(*existingFace).allowCongestionMarking, false);
+  BOOST_CHECK_EQUAL(getOptions(*newFace).allowCongestionMarking, false);
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD_ACTION, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG_UNKNOWN, true), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ProcessConfig
 
 BOOST_AUTO_TEST_SUITE_END() // TestFaceSystem
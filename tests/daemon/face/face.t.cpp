@@ -77,6 +77,19 @@ BOOST_AUTO_TEST_CASE(StaticProperties)
   BOOST_CHECK_EQUAL(face->getPersistency(), ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
 }
 
+BOOST_AUTO_TEST_CASE(IncomingFaceIdTag)
+{
+  auto face = make_unique<DummyFace>();
+  BOOST_REQUIRE(face->getIncomingFaceIdTag() != nullptr);
+  BOOST_CHECK_EQUAL(*face->getIncomingFaceIdTag(), INVALID_FACEID);
+
+  face->setId(222);
+  shared_ptr<lp::IncomingFaceIdTag> tag = face->getIncomingFaceIdTag();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(*tag, 222);
+  BOOST_CHECK_EQUAL(face->getIncomingFaceIdTag(), tag); // same tag is returned every time
+}
+
 BOOST_AUTO_TEST_CASE(State)
 {
   auto face = make_shared<DummyFace>();
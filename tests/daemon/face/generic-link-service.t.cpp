@@ -25,6 +25,7 @@
 
 #include "face/generic-link-service.hpp"
 #include "face/face.hpp"
+#include "face/shared-encoding.hpp"
 #include "dummy-transport.hpp"
 #include <ndn-cxx/lp/tags.hpp>
 
@@ -40,7 +41,7 @@ BOOST_AUTO_TEST_SUITE(Face)
 
 using nfd::Face;
 
-class GenericLinkServiceFixture : public BaseFixture
+class GenericLinkServiceFixture : public UnitTestTimeFixture
 {
 protected:
   GenericLinkServiceFixture()
@@ -145,6 +146,93 @@ BOOST_AUTO_TEST_CASE(SendNack)
   BOOST_CHECK(!nack1pkt.has<lp::SequenceField>());
 }
 
+BOOST_AUTO_TEST_CASE(SendSharedEncoding)
+{
+  // Initialize with Options that enables local fields
+  GenericLinkService::Options options;
+  options.allowLocalFields = true;
+  initialize(options);
+
+  Face face2(make_unique<GenericLinkService>(options), make_unique<DummyTransport>());
+  auto transport2 = static_cast<DummyTransport*>(face2.getTransport());
+  options.allowLocalFields = false;
+  Face face3(make_unique<GenericLinkService>(options), make_unique<DummyTransport>());
+  auto transport3 = static_cast<DummyTransport*>(face3.getTransport());
+
+  shared_ptr<Data> data1 = makeData("/MnsDRLsRl4");
+  data1->setTag(make_shared<lp::IncomingFaceIdTag>(1000));
+
+  {
+    SharedEncodingScope sharedEncoding(*data1);
+
+    // same Data sent to two faces in a scope is encoded once
+    face->sendData(*data1);
+    face2.sendData(*data1);
+
+    // a face that disallows local fields does not share the encoding
+    face3.sendData(*data1);
+  }
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_REQUIRE_EQUAL(transport2->sentPackets.size(), 1);
+  BOOST_REQUIRE_EQUAL(transport3->sentPackets.size(), 1);
+  Block wire1 = transport->sentPackets.back().packet;
+  Block wire2 = transport2->sentPackets.back().packet;
+  BOOST_CHECK(wire1.wire() == wire2.wire());
+  lp::Packet sent1(wire1);
+  BOOST_REQUIRE(sent1.has<lp::IncomingFaceIdField>());
+  BOOST_CHECK_EQUAL(sent1.get<lp::IncomingFaceIdField>(), 1000);
+  lp::Packet sent3(transport3->sentPackets.back().packet);
+  BOOST_CHECK(!sent3.has<lp::IncomingFaceIdField>());
+
+  // the encoding is released when the scope ends
+  BOOST_CHECK(data1->getTag<SharedEncodingTag>() == nullptr);
+  data1->setTag(make_shared<lp::IncomingFaceIdTag>(2000));
+  face->sendData(*data1);
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  Block wire4 = transport->sentPackets.back().packet;
+  BOOST_CHECK(wire4.wire() != wire1.wire());
+  lp::Packet sent4(wire4);
+  BOOST_REQUIRE(sent4.has<lp::IncomingFaceIdField>());
+  BOOST_CHECK_EQUAL(sent4.get<lp::IncomingFaceIdField>(), 2000);
+}
+
+BOOST_AUTO_TEST_CASE(SendSharedEncodingRefreshNonce)
+{
+  // Initialize with Options that disables all services
+  GenericLinkService::Options options;
+  options.allowLocalFields = false;
+  initialize(options);
+
+  Face face2(make_unique<GenericLinkService>(options), make_unique<DummyTransport>());
+  auto transport2 = static_cast<DummyTransport*>(face2.getTransport());
+
+  shared_ptr<Interest> interest1 = makeInterest("/FpDIoSnYVf");
+  uint32_t nonce1 = interest1->getNonce();
+  SharedEncodingScope sharedEncoding(*interest1);
+  face->sendInterest(*interest1);
+
+  // a copy shares the wire encoding and the tags of the original;
+  // refreshNonce may rewrite the shared buffer in place
+  Interest probe(*interest1);
+  probe.refreshNonce();
+  BOOST_REQUIRE_NE(probe.getNonce(), nonce1);
+  face2.sendInterest(probe);
+
+  auto getSentNonce = [] (const Block& wire) {
+    lp::Packet lpPacket(wire);
+    ndn::Buffer::const_iterator fragBegin, fragEnd;
+    std::tie(fragBegin, fragEnd) = lpPacket.get<lp::FragmentField>();
+    return Interest(Block(&*fragBegin, std::distance(fragBegin, fragEnd))).getNonce();
+  };
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_REQUIRE_EQUAL(transport2->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(getSentNonce(transport->sentPackets.back().packet), nonce1);
+  BOOST_CHECK_EQUAL(getSentNonce(transport2->sentPackets.back().packet), probe.getNonce());
+}
+
 BOOST_AUTO_TEST_CASE(ReceiveBareInterest)
 {
   // Initialize with Options that disables all services
@@ -773,6 +861,162 @@ BOOST_AUTO_TEST_CASE(ReceiveCongestionMarkNack)
 BOOST_AUTO_TEST_SUITE_END() // LpFields
 
 
+class CongestionMarkingFixture : public GenericLinkServiceFixture
+{
+protected:
+  CongestionMarkingFixture()
+  {
+    options.allowCongestionMarking = true;
+    options.congestionTarget = time::milliseconds(5);
+    options.congestionThreshold = 10000;
+    options.congestionInterval = time::milliseconds(100);
+  }
+
+  /** \brief send an Interest and return whether it was transmitted with CongestionMark
+   */
+  bool
+  sendInterestAndCheckMark()
+  {
+    face->sendInterest(*makeInterest("/A"));
+    BOOST_REQUIRE(!transport->sentPackets.empty());
+    lp::Packet sent(transport->sentPackets.back().packet);
+    return sent.has<lp::CongestionMarkField>();
+  }
+
+protected:
+  GenericLinkService::Options options;
+};
+
+BOOST_FIXTURE_TEST_SUITE(CongestionMarking, CongestionMarkingFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  options.allowCongestionMarking = false;
+  initialize(options);
+  transport->sendQueueDelay = time::milliseconds(500);
+
+  for (int i = 0; i < 5; ++i) {
+    BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+    this->advanceClocks(time::milliseconds(100));
+  }
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 0);
+}
+
+BOOST_AUTO_TEST_CASE(MarkInterest)
+{
+  initialize(options);
+
+  transport->sendQueueDelay = time::milliseconds(2); // below target
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+
+  transport->sendQueueDelay = time::milliseconds(10);
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false); // delay rises above target
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false); // not yet for a full interval
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), true); // first signal
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), true); // second signal, next one after 100/sqrt(2) ms
+  this->advanceClocks(time::milliseconds(70));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+  this->advanceClocks(time::milliseconds(1));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), true);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 3);
+
+  // queue drains below target
+  transport->sendQueueDelay = time::milliseconds(1);
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+
+  // delay must again stay above target for a full interval
+  transport->sendQueueDelay = time::milliseconds(10);
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+  this->advanceClocks(time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), true);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 4);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionDropped, 0);
+}
+
+BOOST_AUTO_TEST_CASE(DropInterest)
+{
+  options.dropOnCongestion = true;
+  initialize(options);
+
+  std::vector<Interest> droppedInterests;
+  face->onDroppedInterest.connect([&] (const Interest& i) { droppedInterests.push_back(i); });
+
+  transport->sendQueueDelay = time::milliseconds(10);
+  face->sendInterest(*makeInterest("/A"));
+  this->advanceClocks(time::milliseconds(100));
+  face->sendInterest(*makeInterest("/B"));
+
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionDropped, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 0);
+  BOOST_REQUIRE_EQUAL(droppedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(droppedInterests.back().getName(), "/B");
+}
+
+BOOST_AUTO_TEST_CASE(MarkData)
+{
+  initialize(options);
+
+  transport->sendQueueDelay = time::milliseconds(10);
+  face->sendData(*makeData("/A"));
+  this->advanceClocks(time::milliseconds(100));
+  face->sendData(*makeData("/B"));
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK(!lp::Packet(transport->sentPackets.front().packet).has<lp::CongestionMarkField>());
+  lp::Packet sent(transport->sentPackets.back().packet);
+  BOOST_REQUIRE(sent.has<lp::CongestionMarkField>());
+  BOOST_CHECK_EQUAL(sent.get<lp::CongestionMarkField>(), 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 1);
+}
+
+BOOST_AUTO_TEST_CASE(DropDataAndNack)
+{
+  options.dropOnCongestion = true;
+  initialize(options);
+
+  transport->sendQueueDelay = time::milliseconds(10);
+  face->sendData(*makeData("/A"));
+  this->advanceClocks(time::milliseconds(100));
+  face->sendData(*makeData("/B"));
+  this->advanceClocks(time::milliseconds(100));
+  face->sendNack(makeNack("/C", 323, lp::NackReason::NO_ROUTE));
+
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionDropped, 2);
+}
+
+BOOST_AUTO_TEST_CASE(QueueLength)
+{
+  initialize(options);
+
+  // a transport without its own send queue reports only the kernel backlog
+  transport->sendQueueLength = 5000; // below threshold
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+
+  transport->sendQueueLength = 20000;
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false); // length rises above threshold
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), true);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 1);
+
+  transport->sendQueueLength = 0;
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(sendInterestAndCheckMark(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CongestionMarking
+
 BOOST_AUTO_TEST_SUITE(Malformed) // receive malformed packets
 
 BOOST_AUTO_TEST_CASE(WrongTlvType)
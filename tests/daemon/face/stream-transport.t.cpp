@@ -70,6 +70,32 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueSojourn, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueDelay(), time::nanoseconds::zero());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().sendQueueSojournTime, 0);
+
+  auto block1 = ndn::encoding::makeStringBlock(300, "hello");
+  this->transport->send(Transport::Packet{Block{block1}});
+  this->transport->send(Transport::Packet{Block{block1}});
+  BOOST_CHECK_GE(this->transport->getSendQueueDelay(), time::nanoseconds::zero());
+
+  std::vector<uint8_t> readBuf(block1.size() * 2);
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  this->limitedIo.defer(time::milliseconds(50)); // let send handlers run
+
+  // both packets have left the send queue
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueDelay(), time::nanoseconds::zero());
+  BOOST_CHECK_GT(this->transport->getCounters().sendQueueSojournTime, 0);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
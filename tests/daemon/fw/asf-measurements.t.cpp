@@ -85,15 +85,15 @@ BOOST_FIXTURE_TEST_CASE(Basic, UnitTestTimeFixture)
 {
   FaceInfo info;
 
-  scheduler::EventId id = scheduler::schedule(time::seconds(1), []{});
   ndn::Name interestName("/ndn/interest");
 
   // Receive Interest and forward to next hop; should update RTO information
-  info.setTimeoutEvent(id, interestName);
+  info.setTimeout(1, interestName);
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), true);
+  BOOST_CHECK_EQUAL(info.getTimeoutId(), 1);
 
   // If the strategy tries to schedule an RTO when one is already scheduled, throw an exception
-  BOOST_CHECK_THROW(info.setTimeoutEvent(id, interestName), FaceInfo::Error);
+  BOOST_CHECK_THROW(info.setTimeout(2, interestName), FaceInfo::Error);
 
   // Receive Data
   shared_ptr<Interest> interest = makeInterest(interestName);
@@ -112,15 +112,61 @@ BOOST_FIXTURE_TEST_CASE(Basic, UnitTestTimeFixture)
   BOOST_CHECK_EQUAL(info.getSrtt(), rtt);
 
   // Send out another Interest which times out
-  info.setTimeoutEvent(id, interestName);
+  info.setTimeout(3, interestName);
+  BOOST_CHECK_EQUAL(info.getTimeoutId(), 3);
 
   info.recordTimeout(interestName);
   BOOST_CHECK_EQUAL(info.getRtt(), RttStats::RTT_TIMEOUT);
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
 }
 
+BOOST_AUTO_TEST_CASE(RecordScheduledTimeout)
+{
+  FaceInfo info;
+  info.setTimeout(1, "/ndn/interest");
+
+  info.recordScheduledTimeout();
+  BOOST_CHECK_EQUAL(info.getRtt(), RttStats::RTT_TIMEOUT);
+  BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestFaceInfo
 
+BOOST_AUTO_TEST_SUITE(TestNamespaceInfo)
+
+BOOST_FIXTURE_TEST_CASE(ExtendFaceInfoLifetime, UnitTestTimeFixture)
+{
+  NamespaceInfo namespaceInfo;
+  DummyFace face;
+  face.setId(300);
+  FaceInfo& info = namespaceInfo.insert(face.getId())->second;
+
+  namespaceInfo.extendFaceInfoLifetime(info, face);
+  this->advanceClocks(time::seconds(1), AsfMeasurements::MEASUREMENTS_LIFETIME / 2);
+  BOOST_CHECK(namespaceInfo.get(face.getId()) != nullptr);
+
+  // extending the lifetime postpones the expiration
+  namespaceInfo.extendFaceInfoLifetime(info, face);
+  this->advanceClocks(time::seconds(1), AsfMeasurements::MEASUREMENTS_LIFETIME / 2 + time::seconds(1));
+  BOOST_CHECK(namespaceInfo.get(face.getId()) != nullptr);
+
+  this->advanceClocks(time::seconds(1), AsfMeasurements::MEASUREMENTS_LIFETIME / 2);
+  BOOST_CHECK(namespaceInfo.get(face.getId()) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Handle)
+{
+  weak_ptr<NamespaceInfo> handle;
+  {
+    NamespaceInfo namespaceInfo;
+    handle = namespaceInfo.getHandle();
+    BOOST_CHECK_EQUAL(handle.lock().get(), &namespaceInfo);
+  }
+  BOOST_CHECK(handle.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNamespaceInfo
+
 BOOST_AUTO_TEST_SUITE_END() // TestAsfStrategy
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
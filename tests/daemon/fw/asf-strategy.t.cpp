@@ -26,6 +26,7 @@
 #include "fw/asf-strategy.hpp"
 
 #include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
 #include "strategy-tester.hpp"
 #include "topology-tester.hpp"
 
@@ -304,6 +305,121 @@ BOOST_AUTO_TEST_CASE(NoPitOutRecordAndProbeInterestNewNonce)
   }
 }
 
+const uint64_t N_PROBING_PREFIXES = 50;
+
+class ProbingBudgetFixture : public UnitTestTimeFixture
+{
+protected:
+  /** \brief a forwarder with N_PROBING_PREFIXES namespaces, each reachable through two faces
+   */
+  class Node
+  {
+  public:
+    Node()
+      : strategy(choose<AsfStrategyTester>(forwarder))
+      , face1(make_shared<DummyFace>())
+      , face2(make_shared<DummyFace>())
+      , face3(make_shared<DummyFace>())
+      , nInterests(0)
+    {
+      forwarder.addFace(face1);
+      forwarder.addFace(face2);
+      forwarder.addFace(face3);
+
+      for (uint64_t i = 0; i < N_PROBING_PREFIXES; ++i) {
+        fib::Entry& fibEntry = *forwarder.getFib().insert(Name("/3WEqwYvM").appendNumber(i)).first;
+        fibEntry.addNextHop(*face1, 10);
+        fibEntry.addNextHop(*face2, 20);
+      }
+    }
+
+    /** \brief send one Interest to every namespace
+     */
+    void
+    sendRound()
+    {
+      for (uint64_t i = 0; i < N_PROBING_PREFIXES; ++i) {
+        shared_ptr<Interest> interest = makeInterest(Name("/3WEqwYvM").appendNumber(i)
+                                                                     .appendNumber(nInterests));
+        shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+        pitEntry->insertOrUpdateInRecord(*face3, *interest);
+        strategy.afterReceiveInterest(*face3, *interest, pitEntry);
+        ++nInterests;
+      }
+    }
+
+    size_t
+    getNProbes() const
+    {
+      return strategy.sendInterestHistory.size() - nInterests;
+    }
+
+  public:
+    Forwarder forwarder;
+    AsfStrategyTester& strategy;
+    shared_ptr<DummyFace> face1;
+    shared_ptr<DummyFace> face2;
+    shared_ptr<DummyFace> face3;
+    size_t nInterests;
+  };
+};
+
+BOOST_FIXTURE_TEST_CASE(ProbingBudget, ProbingBudgetFixture)
+{
+  Node node;
+  node.forwarder.getProbingBudget().setProbesPerSecond(1.0);
+
+  // every namespace becomes eligible for probing within 5 seconds after its first Interest
+  node.sendRound();
+  this->advanceClocks(time::milliseconds(100), time::seconds(5));
+
+  // one probe per second is shared by all namespaces
+  for (int i = 0; i < 10; ++i) {
+    node.sendRound();
+    this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  }
+  BOOST_CHECK_GE(node.getNProbes(), 10);
+  BOOST_CHECK_LE(node.getNProbes(), 11);
+
+  // with a larger budget, every remaining namespace is probed on its next Interest
+  node.forwarder.getProbingBudget().setProbesPerSecond(1000.0);
+  node.sendRound();
+  BOOST_CHECK_EQUAL(node.getNProbes(), N_PROBING_PREFIXES);
+}
+
+BOOST_FIXTURE_TEST_CASE(PerForwarderProbingBudget, ProbingBudgetFixture)
+{
+  Node nodeA;
+  nodeA.forwarder.getProbingBudget().setProbesPerSecond(1.0);
+  Node nodeB;
+  BOOST_CHECK_EQUAL(nodeB.forwarder.getProbingBudget().getProbesPerSecond(),
+                    fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND);
+
+  nodeA.sendRound();
+  nodeB.sendRound();
+  this->advanceClocks(time::milliseconds(100), time::seconds(5));
+
+  // the small budget of nodeA does not limit nodeB
+  for (int i = 0; i < 10; ++i) {
+    nodeA.sendRound();
+    nodeB.sendRound();
+    this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  }
+  BOOST_CHECK_GE(nodeA.getNProbes(), 10);
+  BOOST_CHECK_LE(nodeA.getNProbes(), 11);
+  BOOST_CHECK_EQUAL(nodeB.getNProbes(), N_PROBING_PREFIXES);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidParameters)
+{
+  Forwarder forwarder;
+  Name name = AsfStrategy::getStrategyName();
+  BOOST_CHECK_THROW(AsfStrategy(forwarder, Name(name).append("probing-budget~500")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(AsfStrategy(forwarder, Name(name).append("probing-interval~1")),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestAsfStrategy
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -144,6 +144,25 @@ BOOST_AUTO_TEST_CASE(Forward)
   // face1 cannot be used because it's gone from FIB entry
 }
 
+BOOST_AUTO_TEST_CASE(SkipDownFace)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 20);
+  fibEntry.addNextHop(*face3, 30);
+
+  // Forwarder refreshes the FIB entry when face state changes
+  face2->setState(face::FaceState::DOWN);
+  BOOST_CHECK(!fibEntry.isNextHopUsable(1));
+
+  shared_ptr<Interest> interest = makeInterest("ndn:/zJsJCDpJ");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face1, *interest);
+  strategy.afterReceiveInterest(*face1, *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, face3->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestBestRouteStrategy2
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -0,0 +1,226 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/congestion-aware-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+typedef StrategyTester<CongestionAwareStrategy> CongestionAwareStrategyTester;
+NFD_REGISTER_STRATEGY(CongestionAwareStrategyTester);
+
+class CongestionAwareStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  CongestionAwareStrategyFixture()
+    : strategy(choose<CongestionAwareStrategyTester>(forwarder))
+    , fib(forwarder.getFib())
+    , pit(forwarder.getPit())
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+    , face3(make_shared<DummyFace>())
+  {
+    forwarder.addFace(face1);
+    forwarder.addFace(face2);
+    forwarder.addFace(face3);
+
+    fib::Entry& fibEntry = *fib.insert(Name()).first;
+    fibEntry.addNextHop(*face1, 10);
+    fibEntry.addNextHop(*face2, 20);
+  }
+
+  /** \brief forward \p nInterests Interests from face3
+   *  \return number of Interests forwarded to face1 and face2
+   */
+  std::pair<size_t, size_t>
+  forwardInterests(size_t nInterests)
+  {
+    strategy.sendInterestHistory.clear();
+    for (size_t i = 0; i < nInterests; ++i) {
+      shared_ptr<Interest> interest = makeInterest(Name("/P").appendNumber(m_nextSeq++));
+      shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+      pitEntry->insertOrUpdateInRecord(*face3, *interest);
+      strategy.afterReceiveInterest(*face3, *interest, pitEntry);
+    }
+
+    std::pair<size_t, size_t> counts{0, 0};
+    for (const auto& args : strategy.sendInterestHistory) {
+      BOOST_CHECK_NE(args.outFaceId, face3->getId());
+      if (args.outFaceId == face1->getId()) {
+        ++counts.first;
+      }
+      else if (args.outFaceId == face2->getId()) {
+        ++counts.second;
+      }
+    }
+    return counts;
+  }
+
+  /** \brief return Data from \p upstream for a newly forwarded Interest
+   */
+  void
+  receiveData(Face& upstream, uint64_t congestionMark)
+  {
+    shared_ptr<Interest> interest = makeInterest(Name("/P").appendNumber(m_nextSeq++));
+    shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face3, *interest);
+    pitEntry->insertOrUpdateOutRecord(upstream, *interest);
+
+    shared_ptr<Data> data = makeData(interest->getName());
+    if (congestionMark > 0) {
+      data->setTag(make_shared<lp::CongestionMarkTag>(congestionMark));
+    }
+    strategy.beforeSatisfyInterest(pitEntry, upstream, *data);
+  }
+
+  const CongestionAwareStrategy::WeightTable*
+  getWeightTable()
+  {
+    measurements::Entry* me = forwarder.getMeasurements().findLongestPrefixMatch("/P");
+    return me == nullptr ? nullptr : me->getStrategyInfo<CongestionAwareStrategy::WeightTable>();
+  }
+
+protected:
+  Forwarder forwarder;
+  CongestionAwareStrategyTester& strategy;
+  Fib& fib;
+  Pit& pit;
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+  shared_ptr<DummyFace> face3;
+
+private:
+  uint64_t m_nextSeq = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestCongestionAwareStrategy, CongestionAwareStrategyFixture)
+
+using WeightTable = CongestionAwareStrategy::WeightTable;
+
+BOOST_AUTO_TEST_CASE(WeightBounds)
+{
+  WeightTable weights;
+  BOOST_CHECK_EQUAL(weights.getWeight(1), WeightTable::INITIAL_WEIGHT);
+
+  weights.decrease(1);
+  BOOST_CHECK_EQUAL(weights.getWeight(1), WeightTable::INITIAL_WEIGHT * WeightTable::MULTIPLICATIVE_DECREASE);
+  for (int i = 0; i < 100; ++i) {
+    weights.decrease(1);
+  }
+  BOOST_CHECK_EQUAL(weights.getWeight(1), WeightTable::MIN_WEIGHT);
+
+  weights.increase(1);
+  BOOST_CHECK_EQUAL(weights.getWeight(1), WeightTable::MIN_WEIGHT + WeightTable::ADDITIVE_INCREASE);
+  for (int i = 0; i < 1000; ++i) {
+    weights.increase(1);
+  }
+  BOOST_CHECK_EQUAL(weights.getWeight(1), WeightTable::MAX_WEIGHT);
+
+  BOOST_CHECK_EQUAL(weights.getWeight(2), WeightTable::INITIAL_WEIGHT);
+}
+
+BOOST_AUTO_TEST_CASE(SplitEvenly)
+{
+  size_t nFace1, nFace2;
+  std::tie(nFace1, nFace2) = this->forwardInterests(1000);
+  BOOST_CHECK_EQUAL(nFace1 + nFace2, 1000);
+  BOOST_CHECK_GT(nFace1, 400);
+  BOOST_CHECK_GT(nFace2, 400);
+  BOOST_CHECK_EQUAL(strategy.rejectPendingInterestHistory.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShiftAwayFromCongestion)
+{
+  this->forwardInterests(1); // create the WeightTable
+  BOOST_REQUIRE(this->getWeightTable() != nullptr);
+
+  for (int i = 0; i < 20; ++i) {
+    this->receiveData(*face1, 1);
+    this->receiveData(*face2, 0);
+  }
+  BOOST_CHECK_EQUAL(this->getWeightTable()->getWeight(face1->getId()), WeightTable::MIN_WEIGHT);
+  BOOST_CHECK_EQUAL(this->getWeightTable()->getWeight(face2->getId()),
+                    WeightTable::INITIAL_WEIGHT + 20 * WeightTable::ADDITIVE_INCREASE);
+
+  size_t nFace1, nFace2;
+  std::tie(nFace1, nFace2) = this->forwardInterests(1000);
+  BOOST_CHECK_EQUAL(nFace1 + nFace2, 1000);
+  BOOST_CHECK_GT(nFace1, 0); // congested path still carries some traffic
+  BOOST_CHECK_LT(nFace1, 100);
+
+  // unmarked Data lets the congested path recover
+  for (int i = 0; i < 100; ++i) {
+    this->receiveData(*face1, 0);
+  }
+  std::tie(nFace1, nFace2) = this->forwardInterests(1000);
+  BOOST_CHECK_GT(nFace1, 400);
+}
+
+BOOST_AUTO_TEST_CASE(NackDecreasesWeight)
+{
+  shared_ptr<Interest> interest = makeInterest("/P/nack", 732);
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face3, *interest);
+  strategy.afterReceiveInterest(*face3, *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  Face& upstream = strategy.sendInterestHistory.back().outFaceId == face1->getId() ? *face1 : *face2;
+  pitEntry->insertOrUpdateOutRecord(upstream, *interest);
+
+  lp::Nack nack = makeNack("/P/nack", 732, lp::NackReason::CONGESTION);
+  pitEntry->getOutRecord(upstream)->setIncomingNack(nack);
+  strategy.afterReceiveNack(upstream, nack, pitEntry);
+
+  BOOST_REQUIRE(this->getWeightTable() != nullptr);
+  BOOST_CHECK_EQUAL(this->getWeightTable()->getWeight(upstream.getId()),
+                    WeightTable::INITIAL_WEIGHT * WeightTable::MULTIPLICATIVE_DECREASE);
+}
+
+BOOST_AUTO_TEST_CASE(SkipDownFace)
+{
+  face1->setState(face::FaceState::DOWN);
+
+  size_t nFace1, nFace2;
+  std::tie(nFace1, nFace2) = this->forwardInterests(100);
+  BOOST_CHECK_EQUAL(nFace1, 0);
+  BOOST_CHECK_EQUAL(nFace2, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCongestionAwareStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -64,6 +64,8 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(face2->sentInterests[0].getName(), "/A/B");
   BOOST_REQUIRE(face2->sentInterests[0].getTag<lp::IncomingFaceIdTag>() != nullptr);
   BOOST_CHECK_EQUAL(*face2->sentInterests[0].getTag<lp::IncomingFaceIdTag>(), face1->getId());
+  BOOST_CHECK_EQUAL(face2->sentInterests[0].getTag<lp::IncomingFaceIdTag>(),
+                    face1->getIncomingFaceIdTag()); // tag is shared, not allocated per packet
   BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 1);
   BOOST_CHECK_EQUAL(forwarder.getCounters().nOutInterests, 1);
   BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 0);
@@ -81,6 +83,48 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(forwarder.getCounters().nOutData, 1);
 }
 
+BOOST_AUTO_TEST_CASE(InterestBatch)
+{
+  Forwarder forwarder;
+  forwarder.setInterestBatchLimit(4);
+
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+  forwarder.getFib().insert("/A").first->addNextHop(*face2, 0);
+
+  // a partial batch is processed after pending I/O completions
+  face1->receiveInterest(*makeInterest("/A/1", 1));
+  face1->receiveInterest(*makeInterest("/A/2", 2));
+  face3->receiveInterest(*makeInterest("/A/1", 1)); // duplicate Nonce within the batch
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 0);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 0);
+
+  this->advanceClocks(time::milliseconds(1), 5);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 3);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face2->sentInterests[0].getName(), "/A/1");
+  BOOST_CHECK_EQUAL(face2->sentInterests[1].getName(), "/A/2");
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 2);
+
+  // a full batch is processed immediately
+  for (int i = 3; i < 7; ++i) {
+    face1->receiveInterest(*makeInterest(Name("/A").appendNumber(i), i));
+  }
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 7);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 6);
+
+  // Interests queued on a face that is closed before the batch runs are dropped
+  face1->receiveInterest(*makeInterest("/A/7", 7));
+  face1->close();
+  this->advanceClocks(time::milliseconds(1), 5);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 7);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 6);
+}
+
 BOOST_AUTO_TEST_CASE(CsMatched)
 {
   Forwarder forwarder;
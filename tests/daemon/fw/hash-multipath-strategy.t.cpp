@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/hash-multipath-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+typedef StrategyTester<HashMultipathStrategy> HashMultipathStrategyTester;
+NFD_REGISTER_STRATEGY(HashMultipathStrategyTester);
+
+class HashMultipathStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  HashMultipathStrategyFixture()
+    : strategy(forwarder)
+    , fib(forwarder.getFib())
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+    , face3(make_shared<DummyFace>())
+    , face4(make_shared<DummyFace>())
+  {
+    forwarder.addFace(face1);
+    forwarder.addFace(face2);
+    forwarder.addFace(face3);
+    forwarder.addFace(face4);
+  }
+
+  FaceId
+  choose(const Name& name, const HashMultipathStrategy& s)
+  {
+    shared_ptr<Interest> interest = makeInterest(name);
+    Face* outFace = s.chooseNextHop(fib.findLongestPrefixMatch(name), *face4, *interest);
+    return outFace == nullptr ? face::INVALID_FACEID : outFace->getId();
+  }
+
+  FaceId
+  choose(const Name& name)
+  {
+    return this->choose(name, strategy);
+  }
+
+protected:
+  Forwarder forwarder;
+  HashMultipathStrategyTester strategy;
+  Fib& fib;
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+  shared_ptr<DummyFace> face3;
+  shared_ptr<DummyFace> face4;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestHashMultipathStrategy, HashMultipathStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  BOOST_CHECK_EQUAL(strategy.getNFlowComponents(), 0);
+
+  // instance names as an operator would type them
+  HashMultipathStrategy s3(forwarder, "/localhost/nfd/strategy/hash-multipath/%FD%01/3");
+  BOOST_CHECK_EQUAL(s3.getNFlowComponents(), 3);
+  BOOST_CHECK_EQUAL(s3.getInstanceName(),
+                    Name(HashMultipathStrategy::getStrategyName()).append("3"));
+  HashMultipathStrategy s12(forwarder, "/localhost/nfd/strategy/hash-multipath/%FD%01/12");
+  BOOST_CHECK_EQUAL(s12.getNFlowComponents(), 12);
+
+  BOOST_CHECK_THROW(HashMultipathStrategy(forwarder,
+                      Name(HashMultipathStrategy::getStrategyName()).append("0")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(HashMultipathStrategy(forwarder,
+                      Name(HashMultipathStrategy::getStrategyName()).append("-1")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(HashMultipathStrategy(forwarder,
+                      Name(HashMultipathStrategy::getStrategyName()).append("x")),
+                    std::invalid_argument);
+  // a nonNegativeInteger component is not decimal text
+  BOOST_CHECK_THROW(HashMultipathStrategy(forwarder,
+                      Name(HashMultipathStrategy::getStrategyName()).appendNumber(3)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(HashMultipathStrategy(forwarder,
+                      Name(HashMultipathStrategy::getStrategyName()).append("1").append("2")),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(FlowAffinity)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 10);
+  fibEntry.addNextHop(*face3, 10);
+
+  for (int flow = 0; flow < 20; ++flow) {
+    Name flowName = Name("/P/video").appendNumber(flow);
+    FaceId first = this->choose(Name(flowName).appendSegment(0));
+    BOOST_CHECK_NE(first, face::INVALID_FACEID);
+    for (int seg = 1; seg < 10; ++seg) {
+      BOOST_CHECK_EQUAL(this->choose(Name(flowName).appendSegment(seg)), first);
+    }
+  }
+
+  // with 2 flow components, all names under /P/video form a single flow
+  HashMultipathStrategy s2(forwarder, Name(HashMultipathStrategy::getStrategyName()).append("2"));
+  FaceId first = this->choose("/P/video/1/seg", s2);
+  for (int flow = 2; flow < 20; ++flow) {
+    BOOST_CHECK_EQUAL(this->choose(Name("/P/video").appendNumber(flow).append("seg"), s2), first);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Spread)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 10);
+  fibEntry.addNextHop(*face3, 10);
+
+  std::map<FaceId, int> nFlows;
+  for (int flow = 0; flow < 300; ++flow) {
+    ++nFlows[this->choose(Name("/P").appendNumber(flow).appendSegment(0))];
+  }
+  BOOST_CHECK_EQUAL(nFlows.count(face4->getId()), 0);
+  BOOST_CHECK_GT(nFlows[face1->getId()], 50);
+  BOOST_CHECK_GT(nFlows[face2->getId()], 50);
+  BOOST_CHECK_GT(nFlows[face3->getId()], 50);
+}
+
+BOOST_AUTO_TEST_CASE(EqualCostOnly)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 10);
+  fibEntry.addNextHop(*face3, 20);
+
+  for (int flow = 0; flow < 100; ++flow) {
+    BOOST_CHECK_NE(this->choose(Name("/P").appendNumber(flow).appendSegment(0)), face3->getId());
+  }
+
+  // higher-cost nexthop is used when lower-cost nexthops are unusable
+  face1->setState(face::FaceState::DOWN);
+  face2->setState(face::FaceState::DOWN);
+  BOOST_CHECK_EQUAL(this->choose("/P/1/seg"), face3->getId());
+}
+
+BOOST_AUTO_TEST_CASE(MinimalDisruption)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 10);
+  fibEntry.addNextHop(*face3, 10);
+
+  std::vector<FaceId> before;
+  for (int flow = 0; flow < 100; ++flow) {
+    before.push_back(this->choose(Name("/P").appendNumber(flow).appendSegment(0)));
+  }
+
+  fibEntry.removeNextHop(*face3);
+  for (int flow = 0; flow < 100; ++flow) {
+    FaceId after = this->choose(Name("/P").appendNumber(flow).appendSegment(0));
+    if (before[flow] != face3->getId()) {
+      BOOST_CHECK_EQUAL(after, before[flow]);
+    }
+    else {
+      BOOST_CHECK_NE(after, face3->getId());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Forward)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 10);
+
+  shared_ptr<Interest> interest = makeInterest("/P/flow/seg");
+  shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face4, *interest);
+
+  strategy.afterReceiveInterest(*face4, *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, this->choose("/P/flow/seg"));
+  BOOST_CHECK_EQUAL(strategy.rejectPendingInterestHistory.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestHashMultipathStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -290,6 +290,50 @@ BOOST_AUTO_TEST_CASE(Bug1998)
   BOOST_CHECK_EQUAL(strategy.sendInterestHistory[0].outFaceId, face2->getId());
 }
 
+BOOST_AUTO_TEST_CASE(BatchedDeadlines)
+{
+  Forwarder forwarder;
+  NccStrategyTester& strategy = choose<NccStrategyTester>(forwarder);
+
+  shared_ptr<DummyFace> face1 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face2 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fibEntry.addNextHop(*face1, 10);
+  fibEntry.addNextHop(*face2, 20);
+
+  Pit& pit = forwarder.getPit();
+
+  // three Interests arrive together, so their propagation deadlines coincide
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (const char* uri : {"ndn:/JUz8sAXa/%00", "ndn:/JUz8sAXa/%01", "ndn:/JUz8sAXa/%02"}) {
+    shared_ptr<Interest> interest = makeInterest(uri);
+    interest->setInterestLifetime(time::milliseconds(2000));
+    shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face3, *interest);
+    strategy.afterReceiveInterest(*face3, *interest, pitEntry);
+    pitEntries.push_back(pitEntry);
+  }
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 3);
+
+  // second Interest is satisfied, third PIT entry is erased, before they are propagated
+  shared_ptr<Data> data = makeData("ndn:/JUz8sAXa/%01");
+  strategy.beforeSatisfyInterest(pitEntries[1], *face1, *data);
+  pit.erase(pitEntries[2].get());
+  pitEntries.resize(1);
+
+  // only the first Interest is propagated to face2
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(200));
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 4);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory[3].pitInterest.getName(), "/JUz8sAXa/%00");
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory[3].outFaceId, face2->getId());
+}
+
 BOOST_AUTO_TEST_CASE_EXPECTED_FAILURES(PredictionAdjustment, 1)
 BOOST_AUTO_TEST_CASE(PredictionAdjustment) // Bug 3411
 {
@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/probing-budget.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestProbingBudget, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Refill)
+{
+  ProbingBudget budget(2.0);
+  BOOST_CHECK_EQUAL(budget.getProbesPerSecond(), 2.0);
+
+  // the budget starts with one second worth of probes
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+
+  this->advanceClocks(time::milliseconds(500));
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+
+  // probes accumulate up to one second worth
+  this->advanceClocks(time::seconds(10));
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+}
+
+BOOST_AUTO_TEST_CASE(SetProbesPerSecond)
+{
+  ProbingBudget budget(1.0);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+
+  budget.setProbesPerSecond(3.0);
+  BOOST_CHECK_EQUAL(budget.getProbesPerSecond(), 3.0);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+
+  // a budget below one probe per second still allows one probe at a time
+  budget.setProbesPerSecond(0.5);
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+  this->advanceClocks(time::seconds(1));
+  BOOST_CHECK_EQUAL(budget.consume(), false);
+  this->advanceClocks(time::seconds(1));
+  BOOST_CHECK_EQUAL(budget.consume(), true);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestProbingBudget
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -33,6 +33,8 @@
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/client-control-strategy.hpp"
+#include "fw/congestion-aware-strategy.hpp"
+#include "fw/hash-multipath-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
 
@@ -79,6 +81,8 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy, false, 1>,
   Test<BestRouteStrategy2, false, 5>,
   Test<ClientControlStrategy, false, 2>,
+  Test<CongestionAwareStrategy, false, 1>,
+  Test<HashMultipathStrategy, true, 1>,
   Test<MulticastStrategy, false, 3>,
   Test<NccStrategy, false, 1>
 >;
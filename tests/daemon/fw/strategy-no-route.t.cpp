@@ -32,6 +32,8 @@
 // sorted alphabetically.
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
+#include "fw/congestion-aware-strategy.hpp"
+#include "fw/hash-multipath-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
 
 #include "tests/test-common.hpp"
@@ -148,6 +150,14 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy2, NextHopIsDownstream<BestRouteStrategy2>>,
   Test<BestRouteStrategy2, NextHopViolatesScope<BestRouteStrategy2>>,
 
+  Test<CongestionAwareStrategy, EmptyNextHopList<CongestionAwareStrategy>>,
+  Test<CongestionAwareStrategy, NextHopIsDownstream<CongestionAwareStrategy>>,
+  Test<CongestionAwareStrategy, NextHopViolatesScope<CongestionAwareStrategy>>,
+
+  Test<HashMultipathStrategy, EmptyNextHopList<HashMultipathStrategy>>,
+  Test<HashMultipathStrategy, NextHopIsDownstream<HashMultipathStrategy>>,
+  Test<HashMultipathStrategy, NextHopViolatesScope<HashMultipathStrategy>>,
+
   Test<MulticastStrategy, EmptyNextHopList<MulticastStrategy>>,
   Test<MulticastStrategy, NextHopIsDownstream<MulticastStrategy>>,
   Test<MulticastStrategy, NextHopViolatesScope<MulticastStrategy>>
@@ -32,6 +32,8 @@
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
+#include "fw/congestion-aware-strategy.hpp"
+#include "fw/hash-multipath-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
 
@@ -110,6 +112,8 @@ using Tests = boost::mpl::vector<
   Test<AsfStrategy, true, false>,
   Test<BestRouteStrategy, false, false>,
   Test<BestRouteStrategy2, true, true>,
+  Test<CongestionAwareStrategy, true, true>,
+  Test<HashMultipathStrategy, true, true>,
   Test<MulticastStrategy, true, true>,
   Test<NccStrategy, false, false>
 >;
@@ -24,9 +24,12 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "face/generic-link-service.hpp"
 #include "core/version.hpp"
 
 #include "nfd-manager-common-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
 
 namespace nfd {
 namespace tests {
@@ -95,6 +98,122 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   // TODO#3325 check packet counter values
 }
 
+BOOST_AUTO_TEST_CASE(PitStatisticsDataset)
+{
+  Pit& pitTable = m_forwarder.getPit();
+  pitTable.getStatistics().setPrefixLength(1);
+  pitTable.insert(*makeInterest("/A/1"));
+  pitTable.insert(*makeInterest("/A/1"));
+  pitTable.insert(*makeInterest("/B/1"));
+  pitTable.erase(pitTable.find(*makeInterest("/B/1")).get());
+
+  Interest request("/localhost/nfd/status/pit");
+  request.setMustBeFresh(true).setChildSelector(1);
+  this->receiveInterest(request);
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+
+  Block total = content.elements()[0];
+  BOOST_REQUIRE_EQUAL(total.type(), tlv::PitStatistics);
+  total.parse();
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(total.get(tlv::NPitInterests)), 3);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(total.get(tlv::NPitAggregated)), 1);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(total.get(tlv::NPitStragglerHits)), 0);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(total.get(tlv::NPitStragglerExpirations)), 0);
+
+  Block unsatisfied = total.get(tlv::PitUnsatisfiedResidency);
+  unsatisfied.parse();
+  BOOST_REQUIRE_EQUAL(unsatisfied.elements().size(), pit::Statistics::N_RESIDENCY_BUCKETS);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(unsatisfied.elements()[0]), 1);
+
+  std::vector<std::pair<Name, uint64_t>> prefixes;
+  for (size_t i = 1; i < content.elements().size(); ++i) {
+    Block record = content.elements()[i];
+    BOOST_REQUIRE_EQUAL(record.type(), tlv::PitPrefixStatistics);
+    record.parse();
+    prefixes.emplace_back(Name(record.get(tlv::Name)),
+                          ndn::readNonNegativeInteger(record.get(tlv::NPitInterests)));
+  }
+  BOOST_REQUIRE_EQUAL(prefixes.size(), 2);
+  BOOST_CHECK_EQUAL(prefixes[0].first, "/A");
+  BOOST_CHECK_EQUAL(prefixes[0].second, 2);
+  BOOST_CHECK_EQUAL(prefixes[1].first, "/B");
+  BOOST_CHECK_EQUAL(prefixes[1].second, 1);
+}
+
+BOOST_AUTO_TEST_CASE(MeasurementsStatisticsDataset)
+{
+  Measurements& measurements = m_forwarder.getMeasurements();
+  measurements.setLimit(2);
+  measurements.get("/A");
+  measurements.get("/B");
+  measurements.get("/C");
+  this->advanceClocks(time::milliseconds(1)); // eviction is deferred
+
+  Interest request("/localhost/nfd/status/measurements");
+  request.setMustBeFresh(true).setChildSelector(1);
+  this->receiveInterest(request);
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+
+  Block block = content.elements()[0];
+  BOOST_REQUIRE_EQUAL(block.type(), tlv::MeasurementsStatistics);
+  block.parse();
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::NMeasurementsEntries)), 2);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::MeasurementsLimit)), 2);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::NMeasurementsEvictions)), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FaceCongestionDataset)
+{
+  auto genericFace = make_shared<Face>(make_unique<face::GenericLinkService>(),
+                                       make_unique<face::tests::DummyTransport>());
+  m_forwarder.addFace(genericFace);
+  auto dummyFace = make_shared<DummyFace>();
+  m_forwarder.addFace(dummyFace);
+
+  const face::FaceCounters& counters = genericFace->getCounters();
+  const auto& transportCounters = counters.get<face::Transport::Counters>();
+  const auto& linkServiceCounters = counters.get<face::GenericLinkService::Counters>();
+  const_cast<PacketCounter&>(counters.nOutPackets).set(4);
+  const_cast<DurationCounter&>(transportCounters.sendQueueSojournTime).set(2000);
+  const_cast<PacketCounter&>(linkServiceCounters.nCongestionMarked).set(3);
+
+  Interest request("/localhost/nfd/status/congestion");
+  request.setMustBeFresh(true).setChildSelector(1);
+  this->receiveInterest(request);
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  bool hasGenericFace = false;
+  bool hasDummyFace = false;
+  for (Block block : content.elements()) {
+    BOOST_REQUIRE_EQUAL(block.type(), tlv::FaceCongestionStatistics);
+    block.parse();
+    FaceId faceId = ndn::readNonNegativeInteger(block.get(ndn::tlv::nfd::FaceId));
+    if (faceId == genericFace->getId()) {
+      hasGenericFace = true;
+      BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::NOutPackets)), 4);
+      BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::SendQueueSojournTime)), 2000);
+      BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::NCongestionMarked)), 3);
+      BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(block.get(tlv::NCongestionDropped)), 0);
+    }
+    else if (faceId == dummyFace->getId()) {
+      hasDummyFace = true;
+      BOOST_CHECK(block.find(tlv::NCongestionMarked) == block.elements_end());
+      BOOST_CHECK(block.find(tlv::NCongestionDropped) == block.elements_end());
+    }
+  }
+  BOOST_CHECK(hasGenericFace);
+  BOOST_CHECK(hasDummyFace);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
@@ -273,6 +273,194 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsUnsolicitedPolicy
 
+BOOST_AUTO_TEST_SUITE(MeasurementsMaxEntries)
+
+BOOST_AUTO_TEST_CASE(NoSection)
+{
+  Measurements& measurements = forwarder.getMeasurements();
+  const size_t initialLimit = measurements.getLimit();
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_NE(measurements.getLimit(), initialLimit);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      measurements_max_entries 101
+    }
+  )CONFIG";
+
+  Measurements& measurements = forwarder.getMeasurements();
+  BOOST_REQUIRE_NE(measurements.getLimit(), 101);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(measurements.getLimit(), 101);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(measurements.getLimit(), 101);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(measurements.getLimit(), 101);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      measurements_max_entries 0
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MeasurementsMaxEntries
+
+BOOST_AUTO_TEST_SUITE(Pit)
+
+BOOST_AUTO_TEST_CASE(NoSection)
+{
+  forwarder.setStragglerTime(time::milliseconds(7));
+  forwarder.getPit().getStatistics().setPrefixLength(3);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(forwarder.getStragglerTime(), Forwarder::DEFAULT_STRAGGLER_TIME);
+  BOOST_CHECK_EQUAL(forwarder.getPit().getStatistics().getPrefixLength(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      pit_straggler_time 250
+      pit_statistics_prefix_length 2
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(forwarder.getStragglerTime(), Forwarder::DEFAULT_STRAGGLER_TIME);
+  BOOST_CHECK_EQUAL(forwarder.getPit().getStatistics().getPrefixLength(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(forwarder.getStragglerTime(), time::milliseconds(250));
+  BOOST_CHECK_EQUAL(forwarder.getPit().getStatistics().getPrefixLength(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      pit_straggler_time fast
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Pit
+
+BOOST_AUTO_TEST_SUITE(InterestBatchLimit)
+
+BOOST_AUTO_TEST_CASE(NoSection)
+{
+  forwarder.setInterestBatchLimit(16);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(forwarder.getInterestBatchLimit(), Forwarder::DEFAULT_INTEREST_BATCH_LIMIT);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      interest_batch_limit 32
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(forwarder.getInterestBatchLimit(), Forwarder::DEFAULT_INTEREST_BATCH_LIMIT);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(forwarder.getInterestBatchLimit(), 32);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      interest_batch_limit 0
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // InterestBatchLimit
+
+BOOST_AUTO_TEST_SUITE(ProbingBudget)
+
+BOOST_AUTO_TEST_CASE(NoSection)
+{
+  forwarder.getProbingBudget().setProbesPerSecond(10.0);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(forwarder.getProbingBudget().getProbesPerSecond(),
+                    fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      probing_budget 50
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(forwarder.getProbingBudget().getProbesPerSecond(),
+                    fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(forwarder.getProbingBudget().getProbesPerSecond(), 50.0);
+
+  // omitting the option restores the default
+  const std::string CONFIG_DEFAULT = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_DEFAULT, false));
+  BOOST_CHECK_EQUAL(forwarder.getProbingBudget().getProbesPerSecond(),
+                    fw::ProbingBudget::DEFAULT_PROBES_PER_SECOND);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      probing_budget 0
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ProbingBudget
+
 BOOST_AUTO_TEST_SUITE(StrategyChoice)
 
 BOOST_AUTO_TEST_CASE(Unversioned)
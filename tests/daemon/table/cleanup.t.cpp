@@ -177,6 +177,81 @@ BOOST_AUTO_TEST_CASE(DeletePitInOutRecords)
   BOOST_CHECK_EQUAL(&foundA->getOutRecords().front().getFace(), face2.get());
 }
 
+BOOST_AUTO_TEST_CASE(OtherFaceUnaffected)
+{
+  NameTree nameTree(16);
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+  size_t nNameTreeEntriesBefore = nameTree.size();
+
+  // '/A/B/C' and its ancestors without table entries should be erased
+  fib.insert("/A/B/C").first->addNextHop(*face1, 0);
+  fib::Entry* entryD = fib.insert("/D").first;
+  entryD->addNextHop(*face1, 0);
+  entryD->addNextHop(*face2, 0);
+
+  shared_ptr<Interest> interestE = makeInterest("/E");
+  shared_ptr<pit::Entry> entryE = pit.insert(*interestE).first;
+  entryE->insertOrUpdateInRecord(*face2, *interestE);
+  entryE->insertOrUpdateOutRecord(*face1, *interestE);
+
+  cleanupOnFaceRemoval(nameTree, fib, pit, *face1);
+  BOOST_CHECK_EQUAL(fib.size(), 1);
+  BOOST_CHECK(nameTree.findExactMatch("/A") == nullptr);
+  BOOST_REQUIRE_EQUAL(entryD->getNextHops().size(), 1);
+  BOOST_CHECK_EQUAL(&entryD->getNextHops().front().getFace(), face2.get());
+  BOOST_CHECK_EQUAL(entryE->getInRecords().size(), 1);
+  BOOST_CHECK_EQUAL(entryE->hasOutRecords(), false);
+  BOOST_CHECK_EQUAL(fib.findEntriesByFace(*face1).size(), 0);
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face1).size(), 0);
+
+  cleanupOnFaceRemoval(nameTree, fib, pit, *face2);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+  BOOST_CHECK_EQUAL(entryE->hasInRecords(), false);
+
+  pit.erase(entryE.get());
+  BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
+}
+
+BOOST_AUTO_TEST_CASE(PitFaceIndex)
+{
+  NameTree nameTree(16);
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+  shared_ptr<Face> face3 = make_shared<DummyFace>();
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<pit::Entry> entryA = pit.insert(*interestA).first;
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face2, *interestA);
+  entryA->insertOrUpdateInRecord(*face3, *interestA);
+
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<pit::Entry> entryB = pit.insert(*interestB).first;
+  entryB->insertOrUpdateOutRecord(*face3, *interestB);
+  BOOST_CHECK_EQUAL(pit.m_faceIndex.size(), 3);
+
+  // records of face1 and face2 are deleted before the faces are removed
+  entryA->clearInRecords();
+  entryA->deleteOutRecord(*face2);
+  pit.erase(entryA.get());
+  entryA.reset();
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face1).size(), 0);
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face2).size(), 0);
+
+  cleanupOnFaceRemoval(nameTree, fib, pit, *face1);
+  cleanupOnFaceRemoval(nameTree, fib, pit, *face2);
+  BOOST_CHECK_EQUAL(pit.m_faceIndex.size(), 1);
+
+  cleanupOnFaceRemoval(nameTree, fib, pit, *face3);
+  BOOST_CHECK_EQUAL(entryB->hasOutRecords(), false);
+  BOOST_CHECK_EQUAL(pit.m_faceIndex.size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // FaceRemovalCleanup
 
 BOOST_AUTO_TEST_SUITE_END() // TestCleanup
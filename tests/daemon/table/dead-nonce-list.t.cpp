@@ -51,6 +51,51 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
 }
 
+BOOST_AUTO_TEST_CASE(FilterRotation)
+{
+  Name name("ndn:/F");
+  DeadNonceList dnl;
+
+  // insert enough Nonces to rotate the Bloom filters several times
+  const uint32_t nNonces = DeadNonceList::INITIAL_CAPACITY * 10;
+  for (uint32_t nonce = 1; nonce <= nNonces; ++nonce) {
+    dnl.add(name, nonce);
+  }
+
+  // every Nonce kept in the index must still be found
+  BOOST_REQUIRE_GE(dnl.size(), DeadNonceList::INITIAL_CAPACITY);
+  for (uint32_t nonce = nNonces - dnl.size() + 1; nonce <= nNonces; ++nonce) {
+    BOOST_CHECK_EQUAL(dnl.has(name, nonce), true);
+  }
+  BOOST_CHECK_EQUAL(dnl.has(name, 1), false);
+  BOOST_CHECK_EQUAL(dnl.has(name, nNonces + 1), false);
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  Name name("ndn:/E");
+  DeadNonceList dnl;
+  dnl.m_capacity = 5000; // larger than the initial ring, which must grow
+
+  for (uint32_t nonce = 1; nonce <= 4000; ++nonce) {
+    dnl.add(name, nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.size(), 4000);
+  for (uint32_t nonce = 1; nonce <= 4000; ++nonce) {
+    BOOST_CHECK_EQUAL(dnl.has(name, nonce), true);
+  }
+
+  // shrinking capacity evicts the oldest entries, at most EVICT_LIMIT per insertion
+  dnl.m_capacity = DeadNonceList::MIN_CAPACITY;
+  for (uint32_t nonce = 4001; nonce <= 8000; ++nonce) {
+    dnl.add(name, nonce);
+  }
+  BOOST_CHECK_LT(dnl.size(), 4000);
+  BOOST_CHECK_EQUAL(dnl.has(name, 1), false);
+  BOOST_CHECK_EQUAL(dnl.has(name, 4000), false);
+  BOOST_CHECK_EQUAL(dnl.has(name, 8000), true);
+}
+
 BOOST_AUTO_TEST_CASE(MinLifetime)
 {
   BOOST_CHECK_THROW(DeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
@@ -334,6 +334,80 @@ BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
   BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
 }
 
+BOOST_AUTO_TEST_CASE(FindEntriesByFace)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  Entry* entryA = fib.insert("/A").first;
+  entryA->addNextHop(*face1, 0);
+  entryA->addNextHop(*face2, 0);
+  Entry* entryB = fib.insert("/B").first;
+  entryB->addNextHop(*face1, 0);
+  Entry* entryC = fib.insert("/C").first;
+  entryC->addNextHop(*face2, 0);
+  fib.insert("/D");
+
+  std::vector<Entry*> found1 = fib.findEntriesByFace(*face1);
+  BOOST_CHECK((std::set<Entry*>(found1.begin(), found1.end()) == std::set<Entry*>{entryA, entryB}));
+
+  entryA->removeNextHop(*face1);
+  found1 = fib.findEntriesByFace(*face1);
+  BOOST_REQUIRE_EQUAL(found1.size(), 1);
+  BOOST_CHECK(found1.front() == entryB);
+
+  fib.erase(*entryB);
+  BOOST_CHECK_EQUAL(fib.findEntriesByFace(*face1).size(), 0);
+
+  fib.removeNextHop(*entryC, *face2);
+  std::vector<Entry*> found2 = fib.findEntriesByFace(*face2);
+  BOOST_REQUIRE_EQUAL(found2.size(), 1);
+  BOOST_CHECK(found2.front() == entryA);
+
+  // a FIB entry that is not part of a FIB is not indexed
+  Entry detachedEntry("/E");
+  detachedEntry.addNextHop(*face2, 0);
+  BOOST_CHECK_EQUAL(fib.findEntriesByFace(*face2).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(UsableNextHops)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  Entry* entry = fib.insert("/A").first;
+  entry->addNextHop(*face1, 20);
+  entry->addNextHop(*face2, 10);
+  BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 2);
+  BOOST_CHECK(entry->isNextHopUsable(0));
+  BOOST_CHECK(entry->isNextHopUsable(1));
+
+  face2->setState(face::FaceState::DOWN);
+  fib.updateUsableNextHops(*face2);
+  BOOST_CHECK_EQUAL(&entry->getNextHops()[0].getFace(), face2.get());
+  BOOST_CHECK(!entry->isNextHopUsable(0));
+  BOOST_CHECK(entry->isNextHopUsable(1));
+  BOOST_CHECK(entry->hasUsableNextHops());
+
+  // the bitmask follows nexthops when they are reordered
+  entry->addNextHop(*face2, 30);
+  BOOST_CHECK_EQUAL(&entry->getNextHops()[1].getFace(), face2.get());
+  BOOST_CHECK(entry->isNextHopUsable(0));
+  BOOST_CHECK(!entry->isNextHopUsable(1));
+
+  entry->removeNextHop(*face1);
+  BOOST_CHECK(!entry->isNextHopUsable(0));
+  BOOST_CHECK(!entry->hasUsableNextHops());
+
+  face2->setState(face::FaceState::UP);
+  fib.updateUsableNextHops(*face2);
+  BOOST_CHECK(entry->isNextHopUsable(0));
+}
+
 BOOST_AUTO_TEST_CASE(Iterator)
 {
   NameTree nameTree;
@@ -226,6 +226,93 @@ BOOST_AUTO_TEST_CASE(Lifetime)
   BOOST_CHECK_EQUAL(measurements.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedExpiry)
+{
+  this->advanceClocks(Measurements::getSweepInterval() / 4);
+  measurements.get("/A");
+  this->advanceClocks(Measurements::getSweepInterval() / 4);
+  measurements.get("/B");
+
+  // /A and /B expire in the same tick, and are erased together at the end of that tick
+  this->advanceClocks(time::milliseconds(1), Measurements::getInitialLifetime());
+  BOOST_CHECK(measurements.findExactMatch("/A") != nullptr);
+  BOOST_CHECK(measurements.findExactMatch("/B") != nullptr);
+
+  this->advanceClocks(time::milliseconds(1), Measurements::getSweepInterval() / 2);
+  BOOST_CHECK(measurements.findExactMatch("/A") == nullptr);
+  BOOST_CHECK(measurements.findExactMatch("/B") == nullptr);
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+  BOOST_CHECK_EQUAL(measurements.getNEvictions(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(LongLifetime)
+{
+  // the lifetime is longer than the ring of expiry buckets,
+  // so the entry is moved to later buckets several times before it expires
+  Entry& entry = measurements.get("/A");
+  measurements.extendLifetime(entry, time::seconds(60));
+
+  this->advanceClocks(time::milliseconds(100), time::seconds(59));
+  BOOST_CHECK(measurements.findExactMatch("/A") != nullptr);
+
+  this->advanceClocks(time::milliseconds(100), time::milliseconds(1200));
+  BOOST_CHECK(measurements.findExactMatch("/A") == nullptr);
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Limit)
+{
+  measurements.setLimit(3);
+  Entry& entryA = measurements.get("/A");
+  measurements.get("/B");
+  measurements.get("/C");
+  BOOST_CHECK_EQUAL(measurements.size(), 3);
+
+  // /B is least recently used, because /A is used after it
+  measurements.extendLifetime(entryA, time::seconds(10));
+  Entry& entryD = measurements.get("/D");
+  // eviction is deferred, so that references held by the caller stay valid
+  BOOST_CHECK_EQUAL(measurements.size(), 4);
+  BOOST_CHECK(measurements.findExactMatch("/B") != nullptr);
+  BOOST_CHECK_EQUAL(entryD.getName(), "/D");
+  this->advanceClocks(time::milliseconds(1));
+  BOOST_CHECK_EQUAL(measurements.size(), 3);
+  BOOST_CHECK_EQUAL(measurements.getNEvictions(), 1);
+  BOOST_CHECK(measurements.findExactMatch("/B") == nullptr);
+
+  measurements.get("/C");
+  measurements.setLimit(1);
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+  BOOST_CHECK_EQUAL(measurements.getNEvictions(), 3);
+  BOOST_CHECK(measurements.findExactMatch("/C") != nullptr);
+
+  // evicted entries are no longer in expiry queue
+  this->advanceClocks(time::seconds(1), time::seconds(12));
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+  BOOST_CHECK_EQUAL(measurements.getNEvictions(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(LimitBelowNameDepth)
+{
+  measurements.setLimit(1);
+
+  // walk up the ancestors while holding the child, as NccStrategy does
+  Entry& child = measurements.get("/A/B/C");
+  size_t nAncestors = 0;
+  for (Entry* parent = measurements.getParent(child); parent != nullptr;
+       parent = measurements.getParent(*parent)) {
+    ++nAncestors;
+  }
+  BOOST_CHECK_EQUAL(nAncestors, 3);
+  BOOST_CHECK_EQUAL(child.getName(), "/A/B/C");
+  BOOST_CHECK_EQUAL(measurements.size(), 4);
+
+  this->advanceClocks(time::milliseconds(1));
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+  BOOST_CHECK_EQUAL(measurements.getNEvictions(), 3);
+  BOOST_CHECK(measurements.findExactMatch("/") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   size_t nNameTreeEntriesBefore = nameTree.size();
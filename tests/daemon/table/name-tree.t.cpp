@@ -431,6 +431,34 @@ BOOST_AUTO_TEST_CASE(LongName)
   BOOST_CHECK_EQUAL(nt.size(), NameTree::getMaxDepth() + 1);
 }
 
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchDeep)
+{
+  NameTree nt;
+  BOOST_CHECK(nt.findLongestPrefixMatch("/A") == nullptr);
+
+  Name deepName;
+  for (int i = 0; i < 30; ++i) {
+    deepName.appendNumber(i);
+  }
+  Entry& deepEntry = nt.lookup(deepName);
+  nt.lookup(deepName.getPrefix(3).append("side"));
+
+  // every prefix length between 0 and 30 is the deepest existing prefix of some query
+  for (size_t len = 0; len <= deepName.size(); ++len) {
+    Name query = deepName.getPrefix(len).append("Q").append("R");
+    Entry* match = nt.findLongestPrefixMatch(query);
+    BOOST_REQUIRE(match != nullptr);
+    BOOST_CHECK_EQUAL(match->getName(), deepName.getPrefix(len));
+  }
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(deepName), &deepEntry);
+
+  // entries rejected by the selector are skipped
+  auto isShallow = [] (const Entry& entry) { return entry.getName().size() <= 3; };
+  Entry* match = nt.findLongestPrefixMatch(deepName, isShallow);
+  BOOST_REQUIRE(match != nullptr);
+  BOOST_CHECK_EQUAL(match->getName(), deepName.getPrefix(3));
+}
+
 /** \brief verify a NameTree enumeration contains expected entries
  *
  *  Example:
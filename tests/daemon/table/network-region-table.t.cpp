@@ -55,6 +55,29 @@ BOOST_AUTO_TEST_CASE(InProducerRegion)
   BOOST_CHECK_EQUAL(nrt4.isInProducerRegion(fh), true);
 }
 
+BOOST_AUTO_TEST_CASE(InsertClear)
+{
+  DelegationList fh{{10, "/telia/terabits"}, {20, "/ucla/cs"}};
+
+  NetworkRegionTable nrt;
+  for (int i = 0; i < 1000; ++i) {
+    nrt.insert(Name("/region").appendNumber(i).append("cs"));
+  }
+  BOOST_CHECK_EQUAL(nrt.size(), 1000);
+  BOOST_CHECK_EQUAL(nrt.insert("/region/%00/cs").second, false);
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh), false);
+
+  nrt.insert("/ucla/cs/irl/lab");
+  BOOST_CHECK_EQUAL(nrt.size(), 1001);
+  BOOST_CHECK(nrt.find("/ucla/cs/irl/lab") != nrt.end());
+  BOOST_CHECK(nrt.find("/ucla/cs") == nrt.end());
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh), true);
+
+  nrt.clear();
+  BOOST_CHECK(nrt.empty());
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(fh), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit-entry-allocator.hpp"
+#include "table/pit-entry.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace pit {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestPitEntryAllocator, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Pool)
+{
+  SlabPool pool(20, 4);
+  BOOST_CHECK_EQUAL(pool.getBlockSize(), 32);
+  BOOST_CHECK_EQUAL(pool.size(), 0);
+  BOOST_CHECK_EQUAL(pool.capacity(), 0);
+
+  std::set<void*> blocks;
+  for (int i = 0; i < 6; ++i) {
+    void* block = pool.allocate();
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(block) % SlabPool::BLOCK_ALIGNMENT, 0);
+    std::memset(block, 0xBB, pool.getBlockSize());
+    blocks.insert(block);
+  }
+  BOOST_CHECK_EQUAL(blocks.size(), 6);
+  BOOST_CHECK_EQUAL(pool.size(), 6);
+  BOOST_CHECK_EQUAL(pool.capacity(), 8);
+
+  // a freed block is reused by the next allocation
+  void* freed = *blocks.begin();
+  pool.deallocate(freed);
+  BOOST_CHECK_EQUAL(pool.size(), 5);
+  BOOST_CHECK_EQUAL(pool.allocate(), freed);
+
+  for (void* block : blocks) {
+    pool.deallocate(block);
+  }
+  BOOST_CHECK_EQUAL(pool.size(), 0);
+  BOOST_CHECK_EQUAL(pool.capacity(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(AllocateShared)
+{
+  shared_ptr<Interest> interest = makeInterest("/A");
+
+  std::vector<shared_ptr<Entry>> entries;
+  for (int i = 0; i < 10; ++i) {
+    entries.push_back(allocate_shared<Entry>(EntryAllocator<Entry>(), *interest));
+    BOOST_CHECK_EQUAL(entries.back()->getName(), "/A");
+  }
+
+  weak_ptr<Entry> weak = entries.front();
+  BOOST_CHECK_EQUAL(weak.lock(), entries.front());
+  BOOST_CHECK_EQUAL(weak.lock()->shared_from_this(), entries.front());
+  entries.clear();
+  BOOST_CHECK(weak.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPitEntryAllocator
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace pit
+} // namespace nfd
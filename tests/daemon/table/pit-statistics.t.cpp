@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit-statistics.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <numeric>
+
+namespace nfd {
+namespace pit {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestPitStatistics, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(ResidencyBucket)
+{
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::nanoseconds::zero()), 0);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::microseconds(999)), 0);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::milliseconds(1)), 1);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::milliseconds(2)), 2);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::milliseconds(3)), 2);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::milliseconds(100)), 7);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::milliseconds(4000)), 12);
+  BOOST_CHECK_EQUAL(Statistics::getResidencyBucket(time::hours(1)),
+                    Statistics::N_RESIDENCY_BUCKETS - 1);
+}
+
+BOOST_AUTO_TEST_CASE(Aggregation)
+{
+  Statistics statistics;
+  BOOST_CHECK_EQUAL(statistics.getPrefixLength(), 0);
+
+  statistics.recordInsert("/A/B/1", true, false);
+  statistics.recordInsert("/A/B/1", false, false);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nInterests, 2);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nAggregated, 1);
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().size(), 0);
+
+  statistics.setPrefixLength(2);
+  statistics.recordInsert("/A/B/2", true, false);
+  statistics.recordInsert("/A/B/2", false, true);
+  statistics.recordInsert("/A/C/1", true, false);
+  statistics.recordInsert("/A", true, false);
+
+  BOOST_CHECK_EQUAL(statistics.getTotal().nInterests, 6);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nAggregated, 2);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nStragglerHits, 1);
+
+  const auto& records = statistics.getPrefixRecords();
+  BOOST_REQUIRE_EQUAL(records.size(), 3);
+  BOOST_CHECK_EQUAL(records.at("/A/B").nInterests, 2);
+  BOOST_CHECK_EQUAL(records.at("/A/B").nAggregated, 1);
+  BOOST_CHECK_EQUAL(records.at("/A/B").nStragglerHits, 1);
+  BOOST_CHECK_EQUAL(records.at("/A/C").nInterests, 1);
+  BOOST_CHECK_EQUAL(records.at("/A/C").nAggregated, 0);
+  BOOST_CHECK_EQUAL(records.at("/A").nInterests, 1);
+
+  statistics.setPrefixLength(2);
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().size(), 3);
+  statistics.setPrefixLength(1);
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().size(), 0);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nInterests, 6);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixRecordLimit)
+{
+  Statistics statistics;
+  statistics.setPrefixLength(1);
+
+  for (size_t i = 0; i < Statistics::MAX_PREFIX_RECORDS + 10; ++i) {
+    statistics.recordInsert(Name("/P").appendNumber(i), true, false);
+  }
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().size(), 1);
+
+  for (size_t i = 0; i < Statistics::MAX_PREFIX_RECORDS + 10; ++i) {
+    statistics.recordInsert(Name().appendNumber(i), true, false);
+  }
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().size(), Statistics::MAX_PREFIX_RECORDS);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nInterests, 2 * (Statistics::MAX_PREFIX_RECORDS + 10));
+}
+
+BOOST_AUTO_TEST_CASE(Residency)
+{
+  Statistics statistics;
+
+  statistics.recordErase(time::milliseconds(150), true, true);
+  statistics.recordErase(time::milliseconds(4000), false, false);
+  statistics.recordErase(time::milliseconds(120), true, false);
+
+  BOOST_CHECK_EQUAL(statistics.getNStragglerExpirations(), 2);
+  BOOST_CHECK_EQUAL(statistics.getSatisfiedResidency()[8], 1);
+  BOOST_CHECK_EQUAL(statistics.getUnsatisfiedResidency()[7], 1);
+  BOOST_CHECK_EQUAL(statistics.getUnsatisfiedResidency()[12], 1);
+  BOOST_CHECK_EQUAL(std::accumulate(statistics.getSatisfiedResidency().begin(),
+                                    statistics.getSatisfiedResidency().end(), uint64_t(0)), 1);
+  BOOST_CHECK_EQUAL(std::accumulate(statistics.getUnsatisfiedResidency().begin(),
+                                    statistics.getUnsatisfiedResidency().end(), uint64_t(0)), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPitStatistics
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2017,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit-timer-wheel.hpp"
+#include "table/pit-entry.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace pit {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+
+class TimerWheelFixture : public UnitTestTimeFixture
+{
+protected:
+  TimerWheelFixture()
+    : wheel(bind(&TimerWheelFixture::onExpire, this, _1))
+  {
+  }
+
+  shared_ptr<Entry>
+  makeEntry(const Name& name)
+  {
+    return make_shared<Entry>(*makeInterest(name));
+  }
+
+  void
+  onExpire(Entry& entry)
+  {
+    BOOST_CHECK(!entry.m_expiryTimer.isArmed());
+    expired.push_back(entry.getName());
+    if (afterExpire) {
+      afterExpire(entry);
+    }
+  }
+
+protected:
+  TimerWheel wheel;
+  std::vector<Name> expired;
+  function<void(Entry&)> afterExpire;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPitTimerWheel, TimerWheelFixture)
+
+BOOST_AUTO_TEST_CASE(ArmExpire)
+{
+  shared_ptr<Entry> entryA = makeEntry("/A");
+  shared_ptr<Entry> entryB = makeEntry("/B");
+  wheel.arm(*entryA, time::steady_clock::now() + time::milliseconds(50));
+  wheel.arm(*entryB, time::steady_clock::now() + time::milliseconds(20));
+  BOOST_CHECK(entryA->m_expiryTimer.isArmed());
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+
+  this->advanceClocks(time::milliseconds(1), 19);
+  BOOST_CHECK(expired.empty());
+  this->advanceClocks(time::milliseconds(1), 2);
+  BOOST_REQUIRE_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(expired[0], "/B");
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  this->advanceClocks(time::milliseconds(1), 28);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+  this->advanceClocks(time::milliseconds(1), 2);
+  BOOST_REQUIRE_EQUAL(expired.size(), 2);
+  BOOST_CHECK_EQUAL(expired[1], "/A");
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  BOOST_CHECK(!entryA->m_expiryTimer.isArmed());
+}
+
+BOOST_AUTO_TEST_CASE(AlreadyExpired)
+{
+  shared_ptr<Entry> entry = makeEntry("/A");
+  wheel.arm(*entry, time::steady_clock::now() - time::seconds(1));
+
+  this->advanceClocks(time::milliseconds(1), 2);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(RearmCancel)
+{
+  shared_ptr<Entry> entryA = makeEntry("/A");
+  shared_ptr<Entry> entryB = makeEntry("/B");
+  wheel.arm(*entryA, time::steady_clock::now() + time::milliseconds(10));
+  wheel.arm(*entryB, time::steady_clock::now() + time::milliseconds(10));
+  wheel.arm(*entryA, time::steady_clock::now() + time::milliseconds(400));
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+  wheel.cancel(*entryB);
+  BOOST_CHECK(!entryB->m_expiryTimer.isArmed());
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  wheel.cancel(*entryB); // no-op
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  this->advanceClocks(time::milliseconds(5), time::milliseconds(395));
+  BOOST_CHECK(expired.empty());
+  this->advanceClocks(time::milliseconds(5), time::milliseconds(10));
+  BOOST_REQUIRE_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(expired[0], "/A");
+}
+
+BOOST_AUTO_TEST_CASE(EntryDestroyed)
+{
+  shared_ptr<Entry> entry = makeEntry("/A");
+  wheel.arm(*entry, time::steady_clock::now() + time::milliseconds(10));
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  entry.reset();
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  this->advanceClocks(time::milliseconds(1), 20);
+  BOOST_CHECK(expired.empty());
+}
+
+BOOST_AUTO_TEST_CASE(LongTimers)
+{
+  // these timers are placed in higher levels, and are cascaded down as time advances
+  std::vector<time::milliseconds> delays{time::milliseconds(300), time::milliseconds(70000),
+                                         time::milliseconds(20000000)};
+  std::vector<shared_ptr<Entry>> entries;
+  for (size_t i = 0; i < delays.size(); ++i) {
+    entries.push_back(makeEntry(Name("/A").appendNumber(i)));
+    wheel.arm(*entries.back(), time::steady_clock::now() + delays[i]);
+  }
+
+  time::milliseconds elapsed(0);
+  for (size_t i = 0; i < delays.size(); ++i) {
+    time::milliseconds step = i == 2 ? time::milliseconds(1000) : time::milliseconds(100);
+    this->advanceClocks(step, delays[i] - step - elapsed);
+    BOOST_CHECK_EQUAL(expired.size(), i);
+    this->advanceClocks(step, step * 2);
+    BOOST_CHECK_EQUAL(expired.size(), i + 1);
+    elapsed = delays[i] + step;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ModifyDuringExpiry)
+{
+  shared_ptr<Entry> entryA = makeEntry("/A");
+  shared_ptr<Entry> entryB = makeEntry("/B");
+  shared_ptr<Entry> entryC = makeEntry("/C");
+  time::steady_clock::TimePoint expiry = time::steady_clock::now() + time::milliseconds(10);
+  wheel.arm(*entryA, expiry);
+  wheel.arm(*entryB, expiry);
+  wheel.arm(*entryC, expiry);
+
+  // the first expired entry in the batch cancels one and re-arms another
+  bool hasModified = false;
+  afterExpire = [&] (Entry& entry) {
+    if (hasModified) {
+      return;
+    }
+    Entry& toCancel = &entry == entryA.get() ? *entryB : *entryA;
+    Entry& toRearm = &entry == entryC.get() ? *entryB : *entryC;
+    wheel.cancel(toCancel);
+    wheel.arm(toRearm, time::steady_clock::now() + time::milliseconds(50));
+    hasModified = true;
+  };
+
+  this->advanceClocks(time::milliseconds(1), 15);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  this->advanceClocks(time::milliseconds(1), 60);
+  BOOST_CHECK_EQUAL(expired.size(), 2);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ArmCancelDuringExpiry)
+{
+  shared_ptr<Entry> entryA = makeEntry("/A");
+  shared_ptr<Entry> entryB = makeEntry("/B");
+  wheel.arm(*entryA, time::steady_clock::now() + time::milliseconds(10));
+
+  // the expiry callback arms a timer and cancels it, leaving the wheel empty
+  afterExpire = [&] (Entry& entry) {
+    if (&entry == entryA.get()) {
+      wheel.arm(*entryB, time::steady_clock::now() + time::milliseconds(50));
+      wheel.cancel(*entryB);
+    }
+  };
+
+  this->advanceClocks(time::milliseconds(1), 15);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  // a timer armed later must still fire
+  this->advanceClocks(time::milliseconds(1), 100);
+  wheel.arm(*entryB, time::steady_clock::now() + time::milliseconds(10));
+  this->advanceClocks(time::milliseconds(1), 15);
+  BOOST_REQUIRE_EQUAL(expired.size(), 2);
+  BOOST_CHECK_EQUAL(expired[1], "/B");
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IdleWheel)
+{
+  shared_ptr<Entry> entry = makeEntry("/A");
+  wheel.arm(*entry, time::steady_clock::now() + time::milliseconds(10));
+  this->advanceClocks(time::milliseconds(1), 20);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+
+  // arming after a long idle period must not fire early or late
+  this->advanceClocks(time::seconds(10), 360);
+  wheel.arm(*entry, time::steady_clock::now() + time::milliseconds(10));
+  this->advanceClocks(time::milliseconds(1), 9);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+  this->advanceClocks(time::milliseconds(1), 2);
+  BOOST_CHECK_EQUAL(expired.size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPitTimerWheel
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace pit
+} // namespace nfd
@@ -346,6 +346,137 @@ BOOST_AUTO_TEST_CASE(InsertMatchLongName)
   BOOST_CHECK(*matches3.begin() == entry3);
 }
 
+BOOST_AUTO_TEST_CASE(FindEntriesByFace)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Interest> interestC = makeInterest("/C");
+  shared_ptr<Entry> entryA = pit.insert(*interestA).first;
+  shared_ptr<Entry> entryB = pit.insert(*interestB).first;
+  shared_ptr<Entry> entryC = pit.insert(*interestC).first;
+
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face2, *interestA);
+  entryB->insertOrUpdateOutRecord(*face1, *interestB);
+  entryC->insertOrUpdateInRecord(*face2, *interestC);
+
+  std::vector<Entry*> found1 = pit.findEntriesByFace(*face1);
+  BOOST_CHECK((std::set<Entry*>(found1.begin(), found1.end()) ==
+               std::set<Entry*>{entryA.get(), entryB.get()}));
+  std::vector<Entry*> found2 = pit.findEntriesByFace(*face2);
+  BOOST_CHECK((std::set<Entry*>(found2.begin(), found2.end()) ==
+               std::set<Entry*>{entryA.get(), entryC.get()}));
+
+  // entry stays indexed while it has either an in-record or an out-record of the face
+  entryA->insertOrUpdateOutRecord(*face1, *interestA);
+  entryA->clearInRecords();
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face1).size(), 2);
+  entryA->deleteOutRecord(*face1);
+  found1 = pit.findEntriesByFace(*face1);
+  BOOST_REQUIRE_EQUAL(found1.size(), 1);
+  BOOST_CHECK(found1.front() == entryB.get());
+
+  pit.deleteInOutRecords(entryB.get(), *face1);
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face1).size(), 0);
+
+  // erased entry is no longer indexed, even if it is modified afterwards
+  pit.erase(entryC.get());
+  found2 = pit.findEntriesByFace(*face2);
+  BOOST_REQUIRE_EQUAL(found2.size(), 1);
+  BOOST_CHECK(found2.front() == entryA.get());
+  entryC->insertOrUpdateOutRecord(*face2, *interestC);
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face2).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FindEntriesByFaceManyRecords)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+  std::vector<shared_ptr<Face>> faces;
+  for (int i = 0; i < 8; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Entry> entryA = pit.insert(*interestA).first;
+  shared_ptr<Entry> entryB = pit.insert(*interestB).first;
+
+  // exceed inline capacity, so that records are moved while they are indexed
+  for (const shared_ptr<Face>& face : faces) {
+    entryA->insertOrUpdateInRecord(*face, *interestA);
+    entryA->insertOrUpdateOutRecord(*face, *interestA);
+  }
+  entryB->insertOrUpdateOutRecord(*faces[3], *interestB);
+
+  // delete records in the middle of the collections
+  entryA->deleteInRecord(*faces[2]);
+  entryA->deleteOutRecord(*faces[2]);
+  entryA->deleteInRecord(*faces[5]);
+
+  for (size_t i = 0; i < faces.size(); ++i) {
+    std::vector<Entry*> found = pit.findEntriesByFace(*faces[i]);
+    std::set<Entry*> expected;
+    if (i != 2) {
+      expected.insert(entryA.get());
+    }
+    if (i == 3) {
+      expected.insert(entryB.get());
+    }
+    BOOST_CHECK((std::set<Entry*>(found.begin(), found.end()) == expected));
+    BOOST_CHECK_EQUAL(found.size(), expected.size());
+  }
+
+  pit.erase(entryA.get());
+  for (const shared_ptr<Face>& face : faces) {
+    BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face).size(), face == faces[3] ? 1 : 0);
+  }
+
+  entryA.reset();
+  entryB->clearInRecords();
+  entryB->deleteOutRecord(*faces[3]);
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*faces[3]).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Handle)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Entry> entryA = pit.insert(*interestA).first;
+  shared_ptr<Entry> entryB = pit.insert(*interestB).first;
+
+  EntryHandle handleA = entryA->getHandle();
+  EntryHandle handleB = entryB->getHandle();
+  BOOST_CHECK(handleA != handleB);
+  BOOST_CHECK_EQUAL(pit.get(handleA), entryA.get());
+  BOOST_CHECK_EQUAL(pit.get(handleB), entryB.get());
+  BOOST_CHECK(pit.get(EntryHandle()) == nullptr);
+
+  // handle does not resolve after the entry is erased, even if the entry is still alive
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.get(handleA) == nullptr);
+  BOOST_CHECK(entryA->getHandle() == EntryHandle());
+  BOOST_CHECK_EQUAL(pit.get(handleB), entryB.get());
+
+  // a new entry may reuse the slot, but the old handle still does not resolve
+  shared_ptr<Interest> interestC = makeInterest("/C");
+  shared_ptr<Entry> entryC = pit.insert(*interestC).first;
+  BOOST_CHECK(pit.get(handleA) == nullptr);
+  BOOST_CHECK_EQUAL(pit.get(entryC->getHandle()), entryC.get());
+
+  // an entry that is not part of a PIT has no handle
+  Entry detached(*interestA);
+  BOOST_CHECK(detached.getHandle() == EntryHandle());
+}
+
 BOOST_AUTO_TEST_CASE(Iterator)
 {
   NameTree nameTree(16);
@@ -388,6 +519,41 @@ BOOST_AUTO_TEST_CASE(Iterator)
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(AggregationStatistics, UnitTestTimeFixture)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+  pit.getStatistics().setPrefixLength(1);
+
+  shared_ptr<Interest> interestA1 = makeInterest("/A/1");
+  shared_ptr<Interest> interestA2 = makeInterest("/A/2");
+
+  shared_ptr<Entry> entryA1 = pit.insert(*interestA1).first;
+  pit.insert(*interestA1);
+  pit.insert(*interestA2);
+  pit.find(*interestA1); // find does not count
+
+  const Statistics& statistics = pit.getStatistics();
+  BOOST_CHECK_EQUAL(statistics.getTotal().nInterests, 3);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nAggregated, 1);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nStragglerHits, 0);
+  BOOST_CHECK_EQUAL(statistics.getPrefixRecords().at("/A").nInterests, 3);
+
+  entryA1->m_isStraggler = true;
+  entryA1->m_isSatisfied = true;
+  pit.insert(*interestA1);
+  BOOST_CHECK_EQUAL(statistics.getTotal().nStragglerHits, 1);
+
+  this->advanceClocks(time::milliseconds(150));
+  pit.erase(entryA1.get());
+  BOOST_CHECK_EQUAL(statistics.getNStragglerExpirations(), 1);
+  BOOST_CHECK_EQUAL(statistics.getSatisfiedResidency()[8], 1);
+
+  this->advanceClocks(time::milliseconds(3850));
+  pit.erase(pit.find(*interestA2).get());
+  BOOST_CHECK_EQUAL(statistics.getUnsatisfiedResidency()[12], 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
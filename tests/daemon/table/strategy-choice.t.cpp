@@ -258,6 +258,34 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(this->findInstanceName(mABCD), strategyNameQ);
 }
 
+BOOST_AUTO_TEST_CASE(EffectiveStrategyCache)
+{
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<pit::Entry> pitABC = pit.insert(*makeInterest("/A/B/C")).first;
+  measurements::Entry& mAB = forwarder.getMeasurements().get("/A/B");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP); // served from cache
+
+  // inserting an entry invalidates the cache below it
+  BOOST_CHECK(sc.insert("/A/B", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameQ);
+
+  // changing the strategy of an entry invalidates the cache
+  BOOST_CHECK(sc.insert("/A/B", strategyNameP));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK(sc.insert("/A", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+
+  // erasing an entry invalidates the cache
+  sc.erase("/A/B");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameQ);
+}
+
 BOOST_AUTO_TEST_CASE(Erase)
 {
   NameTree& nameTree = forwarder.getNameTree();
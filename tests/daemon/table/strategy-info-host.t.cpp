@@ -77,6 +77,32 @@ public:
   int m_id;
 };
 
+template<int N>
+class NumberedStrategyInfo : public StrategyInfo, noncopyable
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 9000 + N;
+  }
+
+  explicit
+  NumberedStrategyInfo(int id)
+    : m_id(id)
+  {
+    ++g_DummyStrategyInfo_count;
+  }
+
+  ~NumberedStrategyInfo()
+  {
+    --g_DummyStrategyInfo_count;
+  }
+
+public:
+  int m_id;
+};
+
 BOOST_AUTO_TEST_SUITE(Table)
 BOOST_FIXTURE_TEST_SUITE(TestStrategyInfoHost, BaseFixture)
 
@@ -131,6 +157,75 @@ BOOST_AUTO_TEST_CASE(Types)
   BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 0);
 }
 
+template<int N>
+static void
+insertNumbered(StrategyInfoHost& host)
+{
+  insertNumbered<N - 1>(host);
+  host.insertStrategyInfo<NumberedStrategyInfo<N>>(N);
+}
+
+template<>
+void
+insertNumbered<0>(StrategyInfoHost& host)
+{
+  host.insertStrategyInfo<NumberedStrategyInfo<0>>(0);
+}
+
+BOOST_AUTO_TEST_CASE(ManyTypes)
+{
+  // more types than inline slots, so that some items are placed in overflow slots
+  static_assert(StrategyInfoHost::N_INLINE_SLOTS < 12, "");
+  StrategyInfoHost host;
+  g_DummyStrategyInfo_count = 0;
+
+  insertNumbered<11>(host);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 12);
+  BOOST_REQUIRE(host.getStrategyInfo<NumberedStrategyInfo<0>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<NumberedStrategyInfo<0>>()->m_id, 0);
+  BOOST_REQUIRE(host.getStrategyInfo<NumberedStrategyInfo<11>>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<NumberedStrategyInfo<11>>()->m_id, 11);
+
+  StrategyInfoHost host2;
+  BOOST_CHECK(host2.getStrategyInfo<NumberedStrategyInfo<11>>() == nullptr);
+  BOOST_CHECK_EQUAL(host2.eraseStrategyInfo<NumberedStrategyInfo<11>>(), 0);
+
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<NumberedStrategyInfo<11>>(), 1);
+  BOOST_CHECK(host.getStrategyInfo<NumberedStrategyInfo<11>>() == nullptr);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 11);
+
+  host.clearStrategyInfo();
+  BOOST_CHECK(host.getStrategyInfo<NumberedStrategyInfo<0>>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<NumberedStrategyInfo<10>>() == nullptr);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Move)
+{
+  g_DummyStrategyInfo_count = 0;
+  {
+    StrategyInfoHost host;
+    DummyStrategyInfo* info = host.insertStrategyInfo<DummyStrategyInfo>(6914).first;
+    host.insertStrategyInfo<NumberedStrategyInfo<10>>(10);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 2);
+
+    StrategyInfoHost host2(std::move(host));
+    BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
+    BOOST_CHECK(host.getStrategyInfo<NumberedStrategyInfo<10>>() == nullptr);
+    BOOST_CHECK_EQUAL(host2.getStrategyInfo<DummyStrategyInfo>(), info);
+    BOOST_REQUIRE(host2.getStrategyInfo<NumberedStrategyInfo<10>>() != nullptr);
+
+    StrategyInfoHost host3;
+    host3.insertStrategyInfo<DummyStrategyInfo>(4287);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 3);
+    host3 = std::move(host2);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 2);
+    BOOST_CHECK_EQUAL(host3.getStrategyInfo<DummyStrategyInfo>(), info);
+    BOOST_CHECK_EQUAL(info->m_id, 6914);
+  }
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyInfoHost
 BOOST_AUTO_TEST_SUITE_END() // Table
 
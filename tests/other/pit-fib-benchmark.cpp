@@ -26,6 +26,7 @@
 #include "benchmark-helpers.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
+#include "core/global-io.hpp"
 
 #include <iostream>
 
@@ -153,5 +154,62 @@ BOOST_FIXTURE_TEST_CASE(SimpleExchanges, PitFibBenchmarkFixture)
   std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
 }
 
+// This test case models PIT expiry timer operations with many outstanding Interests.
+// Timers of nInterests PIT entries are armed, re-armed as if a retransmission arrived,
+// partially cancelled as if Data arrived, and then the remaining timers are left to expire.
+BOOST_FIXTURE_TEST_CASE(ExpiryTimers, PitFibBenchmarkFixture)
+{
+  // number of outstanding Interests
+  const size_t nInterests = 1000000;
+  // one out of cancelRatio Interests is satisfied before expiry
+  const size_t cancelRatio = 4;
+  // Interest lifetimes are spread over this many milliseconds
+  const int lifetimeSpread = 1000;
+
+  generatePacketsAndPopulateFib(nInterests, 2000, 1, 2, 3);
+  for (size_t i = 0; i < nInterests; ++i) {
+    pitEntries.push_back(m_pit.insert(*interests[i]).first);
+  }
+
+  size_t nExpired = 0;
+  pit::TimerWheel wheel([&nExpired] (pit::Entry&) { ++nExpired; });
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  auto t1 = time::steady_clock::now();
+  for (size_t i = 0; i < nInterests; ++i) {
+    wheel.arm(*pitEntries[i], t1 + time::milliseconds(1000 + i % lifetimeSpread));
+  }
+
+  auto t2 = time::steady_clock::now();
+  for (size_t i = 0; i < nInterests; ++i) {
+    wheel.arm(*pitEntries[i], t2 + time::milliseconds(1000 + (i * 7) % lifetimeSpread));
+  }
+
+  auto t3 = time::steady_clock::now();
+  for (size_t i = 0; i < nInterests; i += cancelRatio) {
+    wheel.cancel(*pitEntries[i]);
+  }
+
+  auto t4 = time::steady_clock::now();
+  getGlobalIoService().run();
+  auto t5 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  BOOST_CHECK_EQUAL(nExpired, nInterests - (nInterests + cancelRatio - 1) / cancelRatio);
+
+  std::cout << "arm " << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
+  std::cout << "re-arm " << time::duration_cast<time::microseconds>(t3 - t2) << std::endl;
+  std::cout << "cancel " << time::duration_cast<time::microseconds>(t4 - t3) << std::endl;
+  // expiry processing is spread over the lifetime spread, most of which is idle waiting
+  std::cout << "expire (wall clock) " << time::duration_cast<time::microseconds>(t5 - t4) << std::endl;
+}
+
 } // namespace tests
 } // namespace nfd
@@ -31,6 +31,9 @@
 #include <ndn-cxx/mgmt/nfd/face-status.hpp>
 #include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
 
+#include <boost/filesystem.hpp>
+#include <fstream>
+
 namespace nfd {
 namespace rib {
 namespace tests {
@@ -543,6 +546,224 @@ BOOST_AUTO_TEST_CASE(OnNotification)
 }
 
 BOOST_AUTO_TEST_SUITE_END() // FaceMonitor
+
+class SnapshotFixture : public LocalhostAuthorizedRibManagerFixture
+{
+public:
+  SnapshotFixture()
+    : dir(UNIT_TEST_CONFIG_PATH "rib-manager-snapshot")
+  {
+    boost::filesystem::remove_all(dir);
+    boost::filesystem::create_directories(dir);
+    m_manager.m_snapshotPath = (dir / "rib.snapshot").string();
+  }
+
+  ~SnapshotFixture()
+  {
+    boost::filesystem::remove_all(dir);
+  }
+
+  static ndn::nfd::FaceStatus
+  makeFaceStatus(uint64_t faceId, const std::string& remoteUri,
+                 ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT)
+  {
+    ndn::nfd::FaceStatus status;
+    status.setFaceId(faceId)
+          .setRemoteUri(remoteUri)
+          .setLocalUri("udp4://192.0.2.1:6363")
+          .setFacePersistency(persistency);
+    return status;
+  }
+
+  static ControlParameters
+  makeSnapshotRoute(const Name& name, const std::string& remoteUri, uint64_t flags = 0)
+  {
+    return ControlParameters()
+      .setName(name)
+      .setUri(remoteUri)
+      .setLocalUri("udp4://192.0.2.1:6363")
+      .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR)
+      .setCost(10)
+      .setFlags(flags);
+  }
+
+  void
+  writeSnapshot(const std::vector<ControlParameters>& routes)
+  {
+    std::ofstream os(m_manager.m_snapshotPath, std::ios::binary);
+    for (const auto& route : routes) {
+      const Block& block = route.wireEncode();
+      os.write(reinterpret_cast<const char*>(block.wire()), block.size());
+    }
+  }
+
+public:
+  boost::filesystem::path dir;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Snapshot, SnapshotFixture)
+
+BOOST_AUTO_TEST_CASE(SaveLoad)
+{
+  std::vector<ndn::nfd::FaceStatus> faces{
+    makeFaceStatus(300, "udp4://192.0.2.2:6363"),
+    makeFaceStatus(301, "udp4://192.0.2.3:6363", ndn::nfd::FACE_PERSISTENCY_ON_DEMAND)
+  };
+
+  // the first face dataset loads the snapshot, which does not exist yet
+  m_manager.removeInvalidFaces(faces);
+  BOOST_CHECK(m_manager.m_hasLoadedSnapshot);
+  BOOST_CHECK(!boost::filesystem::exists(m_manager.m_snapshotPath));
+
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register",
+                                            makeRegisterParameters("/A", 300)));
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register",
+                                            makeRegisterParameters("/B", 300, time::seconds(100))));
+  receiveInterest(makeControlCommandRequest("/localhost/nfd/rib/register",
+                                            makeRegisterParameters("/C", 301)));
+  BOOST_REQUIRE_EQUAL(m_rib.size(), 3);
+
+  // the snapshot is saved shortly after the RIB changes
+  BOOST_CHECK(!boost::filesystem::exists(m_manager.m_snapshotPath));
+  advanceClocks(time::seconds(1), 6); // RibManager::SNAPSHOT_SAVE_DELAY = 5s
+  BOOST_CHECK(boost::filesystem::exists(m_manager.m_snapshotPath));
+  BOOST_CHECK(!m_manager.m_isSnapshotSaveScheduled);
+
+  // after a restart, the persistent face has the same FaceUris but a different FaceId
+  m_manager.m_hasLoadedSnapshot = false;
+  while (!m_rib.empty()) {
+    m_rib.erase(m_rib.begin()->first, *m_rib.begin()->second->begin());
+  }
+  m_commands.clear();
+  std::vector<ndn::nfd::FaceStatus> newFaces{
+    makeFaceStatus(400, "udp4://192.0.2.4:6363"),
+    makeFaceStatus(401, "udp4://192.0.2.2:6363")
+  };
+  m_manager.removeInvalidFaces(newFaces);
+  BOOST_CHECK(m_manager.m_hasLoadedSnapshot);
+  BOOST_CHECK(m_manager.m_pendingRoutes.empty());
+
+  BOOST_REQUIRE_EQUAL(m_rib.size(), 2);
+  auto entryA = m_rib.find("/A");
+  BOOST_REQUIRE(entryA != m_rib.end());
+  BOOST_CHECK(entryA->second->hasFaceId(401));
+  auto entryB = m_rib.find("/B");
+  BOOST_REQUIRE(entryB != m_rib.end());
+  BOOST_REQUIRE(entryB->second->hasFaceId(401));
+  BOOST_CHECK(static_cast<bool>(entryB->second->begin()->expires));
+  BOOST_CHECK(m_rib.find("/C") == m_rib.end());
+
+  // the FIB is updated through FibUpdater, in a single batch
+  BOOST_REQUIRE_EQUAL(m_commands.size(), 2);
+  BOOST_CHECK_EQUAL(checkCommand(0, "add-nexthop", makeRegisterParameters("/A", 401)),
+                    CheckCommandResult::OK);
+  BOOST_CHECK_EQUAL(checkCommand(1, "add-nexthop", makeRegisterParameters("/B", 401)),
+                    CheckCommandResult::OK);
+}
+
+BOOST_AUTO_TEST_CASE(Batches)
+{
+  size_t nBatches = 0;
+  m_rib.m_onSendBatchFromQueue = [this, &nBatches] (const RibUpdateBatch& batch) {
+    ++nBatches;
+    onSendBatchFromQueue(batch);
+  };
+
+  writeSnapshot({
+    makeSnapshotRoute("/A", "udp4://192.0.2.2:6363", ndn::nfd::ROUTE_FLAG_CHILD_INHERIT),
+    makeSnapshotRoute("/A/B", "udp4://192.0.2.3:6363"),
+    makeSnapshotRoute("/A/C", "udp4://192.0.2.3:6363"),
+    makeSnapshotRoute("/A", "udp4://192.0.2.3:6363"),
+    makeSnapshotRoute("/D", "udp4://192.0.2.3:6363")
+  });
+  std::vector<ndn::nfd::FaceStatus> faces{
+    makeFaceStatus(300, "udp4://192.0.2.2:6363"),
+    makeFaceStatus(301, "udp4://192.0.2.3:6363")
+  };
+  m_manager.removeInvalidFaces(faces);
+
+  // {/A 300, /D}, {/A 301}, {/A/B, /A/C}: a batch never contains a name and its prefix
+  BOOST_CHECK_EQUAL(nBatches, 3);
+  BOOST_REQUIRE_EQUAL(m_rib.size(), 4);
+  BOOST_CHECK_EQUAL(m_rib.find("/A")->second->getNRoutes(), 2);
+
+  // routes registered in an earlier batch are inherited by names in a later batch
+  Route inherited;
+  inherited.faceId = 300;
+  BOOST_CHECK(m_rib.find("/A/B")->second->hasInheritedRoute(inherited));
+  BOOST_CHECK(m_rib.find("/A/C")->second->hasInheritedRoute(inherited));
+}
+
+BOOST_AUTO_TEST_CASE(PendingRoutes)
+{
+  writeSnapshot({
+    makeSnapshotRoute("/A", "udp4://192.0.2.2:6363"),
+    makeSnapshotRoute("/B", "udp4://192.0.2.3:6363")
+  });
+  std::vector<ndn::nfd::FaceStatus> faces{makeFaceStatus(300, "udp4://192.0.2.2:6363")};
+  m_manager.removeInvalidFaces(faces);
+  BOOST_CHECK_EQUAL(m_rib.size(), 1);
+  BOOST_REQUIRE_EQUAL(m_manager.m_pendingRoutes.size(), 1);
+
+  // a saved snapshot keeps the route whose face does not exist yet
+  m_manager.saveSnapshot();
+  m_manager.m_pendingRoutes.clear();
+  m_manager.m_hasLoadedSnapshot = false;
+  m_manager.removeInvalidFaces(faces);
+  BOOST_REQUIRE_EQUAL(m_manager.m_pendingRoutes.size(), 1);
+  BOOST_CHECK_EQUAL(m_manager.m_pendingRoutes.front().parameters.getName(), "/B");
+
+  // the route is registered when its face is created
+  ndn::nfd::FaceEventNotification notification;
+  notification.setKind(ndn::nfd::FACE_EVENT_CREATED)
+              .setFaceId(302)
+              .setRemoteUri("udp4://192.0.2.3:6363")
+              .setLocalUri("udp4://192.0.2.1:6363")
+              .setFacePersistency(ndn::nfd::FACE_PERSISTENCY_PERSISTENT);
+  m_manager.onNotification(notification);
+  BOOST_CHECK(m_manager.m_pendingRoutes.empty());
+  auto entryB = m_rib.find("/B");
+  BOOST_REQUIRE(entryB != m_rib.end());
+  BOOST_CHECK(entryB->second->hasFaceId(302));
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  std::vector<ndn::nfd::FaceStatus> faces{makeFaceStatus(300, "udp4://192.0.2.2:6363")};
+  const Block& route = ControlParameters()
+                       .setName("/A")
+                       .setUri("udp4://192.0.2.2:6363")
+                       .setLocalUri("udp4://192.0.2.1:6363")
+                       .wireEncode();
+  {
+    std::ofstream os(m_manager.m_snapshotPath, std::ios::binary);
+    os.write(reinterpret_cast<const char*>(route.wire()), route.size());
+    os.write(reinterpret_cast<const char*>(route.wire()), route.size() - 1);
+  }
+
+  // a truncated snapshot is ignored as a whole
+  m_manager.removeInvalidFaces(faces);
+  BOOST_CHECK(m_manager.m_pendingRoutes.empty());
+  BOOST_CHECK_EQUAL(m_rib.size(), 0);
+  BOOST_CHECK_EQUAL(m_commands.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Config)
+{
+  ConfigFile config;
+  m_manager.setConfigFile(config);
+
+  config.parse("rib\n{\n  snapshot rib.snapshot\n}\n", false, "/etc/ndn/nfd.conf");
+  BOOST_CHECK_EQUAL(m_manager.m_snapshotPath, "/etc/ndn/rib.snapshot");
+
+  config.parse("rib\n{\n  snapshot /var/lib/ndn/nfd/rib.snapshot\n}\n", true, "/etc/ndn/nfd.conf");
+  BOOST_CHECK_EQUAL(m_manager.m_snapshotPath, "/etc/ndn/rib.snapshot");
+
+  config.parse("rib\n{\n}\n", false, "/etc/ndn/nfd.conf");
+  BOOST_CHECK_EQUAL(m_manager.m_snapshotPath, "");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Snapshot
 BOOST_AUTO_TEST_SUITE_END() // TestRibManager
 
 } // namespace tests